@@ -0,0 +1,133 @@
+/**
+ * @file launch_bench.cpp
+ * @brief Benchmarks the cost of launching a child with a large environment.
+ *
+ * This program inflates the environment and the descriptor table, then times
+ * fork() + exec of a trivial command in four configurations, so the effect of each
+ * change is reported on its own:
+ *  - baseline:    execvp() with the live `environ` and every descriptor inherited
+ *                 (the old behavior).
+ *  - envp:        execvpe() with the cached EnvSnapshot array, descriptors inherited.
+ *  - close_range: execvp() with the live `environ`, every non-stdio descriptor
+ *                 flagged close-on-exec with close_range().
+ *  - both:        the cached array and close_range() together (the new behavior).
+ *
+ * Usage: launch_bench [launches] [variables] [descriptors]
+ *
+ * @author Noah Nickles
+ * @author Dylan Stephens
+ * @date 10/19/2026
+ * @details Course COP4634
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "env_snapshot.hpp"
+
+// Command launched by every iteration.
+static constexpr const char* COMMAND = "true";
+
+// Default number of launches per configuration.
+static constexpr int DEFAULT_LAUNCHES = 500;
+
+// Default number of extra environment variables.
+static constexpr int DEFAULT_VARIABLES = 4096;
+
+// Default number of extra open descriptors.
+static constexpr int DEFAULT_DESCRIPTORS = 1024;
+
+/**
+ * @brief Forks and execs COMMAND, then waits for it.
+ *
+ * @param envp The environment to hand to the child, or nullptr for execvp() with `environ`.
+ * @param closeDescriptors Whether the child flags non-stdio descriptors close-on-exec.
+ */
+void launch(char* const* envp, bool closeDescriptors) {
+    char* args[] = { const_cast<char*>(COMMAND), nullptr };
+
+    pid_t pid = fork();
+    if(pid == 0) {
+        if(closeDescriptors) {
+            close_range(3, ~0U, CLOSE_RANGE_CLOEXEC);
+        }
+        if(envp == nullptr) {
+            execvp(COMMAND, args);
+        }
+        else {
+            execvpe(COMMAND, args, envp);
+        }
+        _exit(EXIT_FAILURE);
+    }
+    else if(pid < 0) {
+        std::cerr << "Error: fork failed (" << strerror(errno) << ")\n";
+        exit(EXIT_FAILURE);
+    }
+
+    int status;
+    waitpid(pid, &status, 0);
+}
+
+/**
+ * @brief Prints the average launch time of one configuration.
+ *
+ * @param label The configuration name.
+ * @param elapsed The total time spent launching.
+ * @param launches The number of launches performed.
+ */
+void report(const char* label, std::chrono::nanoseconds elapsed, int launches) {
+    double micros = elapsed.count() / 1000.0 / launches;
+    std::cout << label << ": " << micros << " us/launch\n";
+}
+
+int main(int argc, char** argv) {
+    int launches    = argc > 1 ? std::atoi(argv[1]) : DEFAULT_LAUNCHES;
+    int variables   = argc > 2 ? std::atoi(argv[2]) : DEFAULT_VARIABLES;
+    int descriptors = argc > 3 ? std::atoi(argv[3]) : DEFAULT_DESCRIPTORS;
+
+    // Inflate the environment with variables of realistic length.
+    std::string value(64, 'x');
+    for(int i = 0; i < variables; i++) {
+        std::string name = "BENCH_VAR_" + std::to_string(i);
+        setenv(name.c_str(), value.c_str(), 1);
+    }
+
+    // Open descriptors without close-on-exec, as a leaky shell would hold them.
+    for(int i = 0; i < descriptors; i++) {
+        if(open("/dev/null", O_RDONLY) < 0) {
+            std::cerr << "Error: could only open " << i << " descriptors\n";
+            break;
+        }
+    }
+
+    std::cout << "launches: " << launches
+              << ", variables: " << variables
+              << ", descriptors: " << descriptors << "\n";
+
+    using Clock = std::chrono::steady_clock;
+    EnvSnapshot snapshot;
+    snapshot.getEnvp(); // Capture the snapshot outside the timed loops.
+
+    // Baseline first, then each change alone, then both together.
+    const char* labels[]    = { "baseline   ", "envp       ", "close_range", "both       " };
+    bool useSnapshot[]      = { false, true, false, true };
+    bool closeDescriptors[] = { false, false, true, true };
+    for(int config = 0; config < 4; config++) {
+        char* const* envp = useSnapshot[config] ? snapshot.getEnvp() : nullptr;
+
+        auto start = Clock::now();
+        for(int i = 0; i < launches; i++) {
+            launch(envp, closeDescriptors[config]);
+        }
+        report(labels[config], Clock::now() - start, launches);
+    }
+
+    return 0;
+}
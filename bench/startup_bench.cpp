@@ -0,0 +1,132 @@
+/**
+ * @file startup_bench.cpp
+ * @brief Benchmarks the wall time of `myshell -c true`.
+ *
+ * This program launches the shell repeatedly and reports the mean and median
+ * wall time per launch in three configurations:
+ *  - no rc:    MYSHELLRC points at a file that doesn't exist.
+ *  - rc cold:  a generated rc file is parsed on every launch (snapshot removed).
+ *  - rc warm:  the rc snapshot is valid and reused.
+ *
+ * Usage: startup_bench [shell] [launches] [definitions]
+ *
+ * @author Noah Nickles
+ * @author Dylan Stephens
+ * @date 10/19/2026
+ * @details Course COP4634
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+// Default path of the shell binary, relative to the repository root.
+static constexpr const char* DEFAULT_SHELL = "./myshell";
+
+// Default number of launches per configuration.
+static constexpr int DEFAULT_LAUNCHES = 200;
+
+// Default number of aliases, variables and functions in the generated rc file.
+static constexpr int DEFAULT_DEFINITIONS = 2000;
+
+/**
+ * @brief Runs `shell -c true` once and waits for it.
+ *
+ * @param shell Path of the shell binary.
+ * @return The wall time of the launch in microseconds.
+ */
+double launch(const char* shell) {
+    char* args[] = { const_cast<char*>(shell), const_cast<char*>("-c"),
+                     const_cast<char*>("true"), nullptr };
+
+    auto start = std::chrono::steady_clock::now();
+    pid_t pid = fork();
+    if(pid == 0) {
+        execv(shell, args);
+        _exit(EXIT_FAILURE);
+    }
+    else if(pid < 0) {
+        std::cerr << "Error: fork failed (" << strerror(errno) << ")\n";
+        exit(EXIT_FAILURE);
+    }
+
+    int status;
+    waitpid(pid, &status, 0);
+    if(!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        std::cerr << "Error: \'" << shell << " -c true\' failed\n";
+        exit(EXIT_FAILURE);
+    }
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+/**
+ * @brief Launches the shell repeatedly and prints the mean and median wall time.
+ *
+ * @param label The configuration name.
+ * @param shell Path of the shell binary.
+ * @param launches The number of launches.
+ * @param snapshot Snapshot path removed before every launch, or nullptr to keep it.
+ */
+void measure(const char* label, const char* shell, int launches, const char* snapshot) {
+    std::vector<double> times;
+    for(int i = 0; i < launches; i++) {
+        if(snapshot != nullptr) {
+            std::remove(snapshot);
+        }
+        times.push_back(launch(shell));
+    }
+
+    double total = 0;
+    for(double time : times) total += time;
+    std::sort(times.begin(), times.end());
+
+    std::cout << label << ": mean " << total / launches
+              << " us, median " << times[launches / 2] << " us\n";
+}
+
+int main(int argc, char** argv) {
+    const char* shell = argc > 1 ? argv[1] : DEFAULT_SHELL;
+    int launches      = argc > 2 ? std::atoi(argv[2]) : DEFAULT_LAUNCHES;
+    int definitions   = argc > 3 ? std::atoi(argv[3]) : DEFAULT_DEFINITIONS;
+
+    // Generate an rc file with the requested number of each kind of definition.
+    std::string rcPath = "/tmp/myshell_startup_bench_" + std::to_string(getpid()) + ".rc";
+    std::string snapshotPath = rcPath + ".snapshot";
+    {
+        std::ofstream rc(rcPath);
+        for(int i = 0; i < definitions; i++) {
+            rc << "alias a" << i << "=\'ls -l /tmp/" << i << "\'\n"
+               << "export BENCH_VAR_" << i << "=value" << i << "\n"
+               << "function f" << i << " {\n"
+               << "    echo " << i << "\n"
+               << "}\n";
+        }
+    }
+
+    std::cout << "shell: " << shell
+              << ", launches: " << launches
+              << ", definitions: " << definitions << "\n";
+
+    std::string missingPath = rcPath + ".missing";
+    setenv("MYSHELLRC", missingPath.c_str(), 1);
+    measure("no rc  ", shell, launches, nullptr);
+
+    setenv("MYSHELLRC", rcPath.c_str(), 1);
+    measure("rc cold", shell, launches, snapshotPath.c_str());
+
+    launch(shell); // Write the snapshot once.
+    measure("rc warm", shell, launches, nullptr);
+
+    std::remove(rcPath.c_str());
+    std::remove(snapshotPath.c_str());
+    return 0;
+}
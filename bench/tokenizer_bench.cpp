@@ -0,0 +1,159 @@
+/**
+ * @file tokenizer_bench.cpp
+ * @brief Benchmarks tokenizer throughput over multi-megabyte command lines.
+ *
+ * This program generates a command line of long path arguments separated by
+ * runs of spaces and tabs, then tokenizes it with strtok() and with every
+ * Tokenizer kernel the CPU supports. Each run is checked against the strtok()
+ * result and the best throughput of several repetitions is printed.
+ *
+ * Usage: tokenizer_bench [megabytes] [repetitions]
+ *
+ * @author Noah Nickles
+ * @author Dylan Stephens
+ * @date 10/19/2026
+ * @details Course COP4634
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "tokenizer.hpp"
+
+// Default size of the generated command line in megabytes.
+static constexpr int DEFAULT_MEGABYTES = 16;
+
+// Default number of timed runs per tokenizer; the fastest is reported.
+static constexpr int DEFAULT_REPETITIONS = 10;
+
+/**
+ * @brief Token count and checksum of one tokenizer run, used to compare results.
+ */
+struct Result {
+    size_t tokens = 0;
+    size_t checksum = 0;
+
+    bool operator==(const Result& other) const {
+        return tokens == other.tokens && checksum == other.checksum;
+    }
+};
+
+/**
+ * @brief Generates a command line of path arguments separated by spaces and tabs.
+ *
+ * @param bytes The approximate length of the command line.
+ * @return The generated command line.
+ */
+std::string generateCommand(size_t bytes) {
+    std::mt19937 random(4634);
+    std::uniform_int_distribution<int> segments(2, 12);
+    std::uniform_int_distribution<int> segmentLength(3, 24);
+    std::uniform_int_distribution<int> letters('a', 'z');
+    std::uniform_int_distribution<int> gap(1, 3);
+
+    std::string command = "cp";
+    command.reserve(bytes + 512);
+    while(command.size() < bytes) {
+        for(int i = gap(random); i > 0; i--) {
+            command += (i % 2 == 0) ? '\t' : ' ';
+        }
+        for(int i = segments(random); i > 0; i--) {
+            command += '/';
+            for(int j = segmentLength(random); j > 0; j--) {
+                command += static_cast<char>(letters(random));
+            }
+        }
+    }
+    command += " >/tmp/out &";
+    return command;
+}
+
+/**
+ * @brief Tokenizes a copy of the command with strtok().
+ */
+Result tokenizeStrtok(std::vector<char>& buffer) {
+    Result result;
+    for(char* token = std::strtok(buffer.data(), DELIMITER_CHARS); token != nullptr;
+        token = std::strtok(nullptr, DELIMITER_CHARS)) {
+        result.tokens++;
+        result.checksum += (token - buffer.data()) ^ static_cast<unsigned char>(token[0]);
+    }
+    return result;
+}
+
+/**
+ * @brief Tokenizes a copy of the command with the selected Tokenizer kernel.
+ */
+Result tokenizeKernel(std::vector<char>& buffer) {
+    Result result;
+    Tokenizer tokenizer(buffer.data());
+    for(char* token = tokenizer.next(); token != nullptr; token = tokenizer.next()) {
+        result.tokens++;
+        result.checksum += (token - buffer.data()) ^ static_cast<unsigned char>(token[0]);
+    }
+    return result;
+}
+
+/**
+ * @brief Times a tokenizer and prints its best throughput.
+ *
+ * @param label The tokenizer name.
+ * @param command The command line to tokenize.
+ * @param repetitions The number of timed runs.
+ * @param tokenize The tokenizer function.
+ * @param expected The strtok() result, or nullptr to skip the check.
+ * @return The result of the last run.
+ */
+Result measure(const char* label, const std::string& command, int repetitions,
+               Result (*tokenize)(std::vector<char>&), const Result* expected) {
+    std::vector<char> buffer(command.size() + 1);
+    double best = 0;
+    Result result;
+
+    for(int i = 0; i < repetitions; i++) {
+        // Tokenizing modifies the buffer, so restore it outside the timed region.
+        std::memcpy(buffer.data(), command.c_str(), buffer.size());
+
+        auto start = std::chrono::steady_clock::now();
+        result = tokenize(buffer);
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        double throughput = command.size() / elapsed.count() / (1024.0 * 1024.0);
+        if(throughput > best) best = throughput;
+    }
+
+    std::cout << label << ": " << best << " MB/s (" << result.tokens << " tokens)";
+    if(expected != nullptr && !(result == *expected)) {
+        std::cout << " MISMATCH\n";
+        exit(EXIT_FAILURE);
+    }
+    std::cout << "\n";
+    return result;
+}
+
+int main(int argc, char** argv) {
+    int megabytes   = argc > 1 ? std::atoi(argv[1]) : DEFAULT_MEGABYTES;
+    int repetitions = argc > 2 ? std::atoi(argv[2]) : DEFAULT_REPETITIONS;
+
+    std::string command = generateCommand(static_cast<size_t>(megabytes) * 1024 * 1024);
+    std::cout << "command: " << command.size() << " bytes, repetitions: " << repetitions << "\n";
+
+    Result expected = measure("strtok", command, repetitions, tokenizeStrtok, nullptr);
+
+    const char* names[] = { "scalar", "sse2  ", "avx2  " };
+    Tokenizer::Kernel kernels[] = { Tokenizer::SCALAR, Tokenizer::SSE2, Tokenizer::AVX2 };
+    for(int i = 0; i < 3; i++) {
+        if(!Tokenizer::isSupported(kernels[i])) {
+            std::cout << names[i] << ": not supported\n";
+            continue;
+        }
+        Tokenizer::selectKernel(kernels[i]);
+        measure(names[i], command, repetitions, tokenizeKernel, &expected);
+    }
+    return 0;
+}
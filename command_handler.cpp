@@ -16,7 +16,7 @@
 
 #include "command_handler.hpp"
 
-void CommandHandler::execute(Param& param) {
+int CommandHandler::execute(Param& param) {
     // Grab argument vector from Param class and get the 0th element.
     char** args = param.getArguments();
     const char* command = args[0];
@@ -27,18 +27,80 @@ void CommandHandler::execute(Param& param) {
         exitProcess();
     }
 
+    // Handle "export" and "unset" commands in the shell itself.
+    if(std::strcmp(command, EXPORT_COMMAND) == 0) {
+        bool valid = exportVariables(args);
+        delete[] args;
+        return valid ? SUCCESS_STATUS : FAILURE_STATUS;
+    }
+    if(std::strcmp(command, UNSET_COMMAND) == 0) {
+        unsetVariables(args);
+        delete[] args;
+        return SUCCESS_STATUS;
+    }
+
+    // Handle the "limit" prefix; the limited command follows its options.
+    ResourceLimits limits;
+    char** commandArgs = args;
+    if(std::strcmp(command, ResourceLimits::LIMIT_COMMAND) == 0) {
+        int commandIndex = limits.parse(args);
+        if(commandIndex == -1) {
+            delete[] args;
+            return FAILURE_STATUS;
+        }
+        commandArgs = args + commandIndex;
+        command = commandArgs[0];
+    }
+
+    // Grab the cached environment before forking so the child only reads it.
+    char* const* envp = environment.getEnvp();
+
+    // Background jobs and failed forks report their own status.
+    int status = SUCCESS_STATUS;
+
+    /*
+     * A timed job leads its own process group so a timeout kills its whole tree. 
+     * In the foreground it also needs the terminal, or reading it would stop the job.
+    */
+    bool background = param.getBackground() == 1;
+    bool grouped = limits.getTimeout() > 0;
+    bool ownsTerminal = grouped && !background && isatty(STDIN_FILENO)
+                        && tcgetpgrp(STDIN_FILENO) == getpgrp();
+
+    // A limited job is tracked from here on, so the shell must not be interrupted.
+    if(limits.isSet()) {
+        ignoreTerminalSignals(true);
+    }
+
     // Fork the process to execute the command.
     pid_t pid = fork();
     if(pid == 0) { // Child process.
+        // The command gets the shell's original Ctrl+C and Ctrl+\ handling.
+        ignoreTerminalSignals(false);
+
+        // Both processes set up the group, so neither order of scheduling races.
+        if(grouped) {
+            setpgid(0, 0);
+        }
+        if(ownsTerminal) {
+            setTerminalOwner(getpid());
+        }
+
         // Check for input/output redirection.
         redirectInput(param);
         redirectOutput(param);
 
+        // Only stdin, stdout and stderr are inherited by the command.
+        closeInheritedDescriptors();
+
+        // Apply the rlimits requested with the "limit" prefix.
+        limits.apply();
+
         /* 
-         * Execute the command using execvp, replacing the child process.
-         * If execvp fails, print an error and exit the child process.
+         * Execute the command using execvpe, replacing the child process.
+         * If execvpe fails, print an error and exit the child process.
         */
-        if(execvp(command, args) == -1) {
+        if(execvpe(command, commandArgs, envp) == -1) {
             std::cerr << "Error: failed to execute command \'"
                       << command
                       << "\'\n";
@@ -49,9 +111,26 @@ void CommandHandler::execute(Param& param) {
         std::cerr << "Error: fork failed (" 
                   << strerror(errno) 
                   << ")\n";
+        status = FAILURE_STATUS;
     }
     else { // Parent process.
-        if(param.getBackground() == 1) {
+        if(grouped) {
+            setpgid(pid, pid);
+        }
+        if(ownsTerminal) {
+            setTerminalOwner(pid);
+        }
+
+        /*
+         * Limited jobs are always tracked. Foreground jobs are tracked too while 
+         * other jobs are, so their timeouts are still enforced during the wait.
+        */
+        bool tracked = false;
+        if(limits.isSet() || (!background && monitor.hasJobs())) {
+            tracked = monitor.track(pid, limits);
+        }
+
+        if(background) {
             // If background flag is set, don't wait for the child process.
             std::cout << "Process running in background [PID: " 
                       << pid 
@@ -59,14 +138,73 @@ void CommandHandler::execute(Param& param) {
         } 
         else {
             // Wait for the child process to complete.
-            int status;
-            waitpid(pid, &status, 0);
+            if(tracked) {
+                status = monitor.wait(pid);
+            }
+            else {
+                waitpid(pid, &status, 0);
+            }
+        }
+
+        // Take the terminal back once the job is gone.
+        if(ownsTerminal) {
+            setTerminalOwner(getpgrp());
         }
     }
+
+    // Only keep ignoring Ctrl+C and Ctrl+\ while limited jobs remain.
+    ignoreTerminalSignals(monitor.hasJobs());
+
     delete[] args;
+    return status;
+}
+
+void CommandHandler::setVariable(const std::string& name, const std::string& value) {
+    environment.setVariable(name, value);
+}
+
+bool CommandHandler::readLine(int inputFd, std::string& line) {
+    size_t searchFrom = 0;
+    while(true) {
+        // Hand out a complete line if one is already buffered.
+        size_t newline = pendingInput.find('\n', searchFrom);
+        if(newline != std::string::npos) {
+            line.assign(pendingInput, 0, newline);
+            pendingInput.erase(0, newline + 1);
+            return true;
+        }
+        searchFrom = pendingInput.size();
+
+        // Nothing else buffers the input, so poll() sees everything that is pending.
+        if(monitor.hasJobs()) {
+            monitor.waitForInput(inputFd);
+            ignoreTerminalSignals(monitor.hasJobs());
+        }
+
+        char chunk[INPUT_CHUNK_SIZE];
+        ssize_t length = read(inputFd, chunk, sizeof(chunk));
+        if(length > 0) {
+            pendingInput.append(chunk, length);
+            continue;
+        }
+        if(length == -1 && errno == EINTR) continue;
+
+        // End of input, a last line without a newline is still a command.
+        if(pendingInput.empty()) return false;
+        line.swap(pendingInput);
+        pendingInput.clear();
+        return true;
+    }
+}
+
+void CommandHandler::finishJobs() {
+    monitor.waitAll();
 }
 
 void CommandHandler::exitProcess() {
+    // Enforce the timeouts of limited jobs while they finish.
+    monitor.waitAll();
+
     // Wait for any remaining child processes to finish.
     int status;
     pid_t pid;
@@ -110,4 +248,79 @@ void CommandHandler::redirectOutput(Param& param) {
             exit(EXIT_FAILURE);
         }
     }
+}
+
+bool CommandHandler::exportVariables(char** args) {
+    bool valid = true;
+    for(int i = 1; args[i] != nullptr; i++) {
+        char* separator = std::strchr(args[i], '=');
+
+        // Require a non-empty name followed by '='.
+        if(separator == nullptr || separator == args[i]) {
+            std::cerr << "Error: expected NAME=VALUE but got \'"
+                      << args[i]
+                      << "\'\n";
+            valid = false;
+            continue;
+        }
+
+        std::string name(args[i], separator - args[i]);
+        environment.setVariable(name, separator + 1);
+    }
+    return valid;
+}
+
+void CommandHandler::unsetVariables(char** args) {
+    for(int i = 1; args[i] != nullptr; i++) {
+        environment.unsetVariable(args[i]);
+    }
+}
+
+void CommandHandler::ignoreTerminalSignals(bool ignore) {
+    if(ignore == ignoringSignals) return;
+
+    for(size_t i = 0; i < std::size(TERMINAL_SIGNALS); i++) {
+        if(ignore) {
+            struct sigaction action = {};
+            action.sa_handler = SIG_IGN;
+            sigaction(TERMINAL_SIGNALS[i], &action, &savedActions[i]);
+        }
+        else {
+            sigaction(TERMINAL_SIGNALS[i], &savedActions[i], nullptr);
+        }
+    }
+    ignoringSignals = ignore;
+}
+
+void CommandHandler::setTerminalOwner(pid_t pgid) {
+    // Block SIGTTOU, a background group may only change the owner while it's blocked.
+    sigset_t block, previous;
+    sigemptyset(&block);
+    sigaddset(&block, SIGTTOU);
+    sigprocmask(SIG_BLOCK, &block, &previous);
+
+    tcsetpgrp(STDIN_FILENO, pgid);
+
+    sigprocmask(SIG_SETMASK, &previous, nullptr);
+}
+
+void CommandHandler::closeInheritedDescriptors() {
+    // Flag every descriptor above stderr close-on-exec in one system call.
+    if(close_range(FIRST_NON_STDIO_FD, ~0U, CLOSE_RANGE_CLOEXEC) == 0) return;
+
+    // Kernels before 5.11 lack CLOSE_RANGE_CLOEXEC, close the descriptors outright.
+    if(close_range(FIRST_NON_STDIO_FD, ~0U, 0) == 0) return;
+
+    // Kernels before 5.9 lack close_range(), close only the descriptors that are open.
+    DIR* directory = opendir("/proc/self/fd");
+    if(directory == nullptr) return;
+
+    int directoryFd = dirfd(directory);
+    while(dirent* entry = readdir(directory)) {
+        int fd = std::atoi(entry->d_name); // "." and ".." parse as 0 and are skipped.
+        if(fd >= static_cast<int>(FIRST_NON_STDIO_FD) && fd != directoryFd) {
+            close(fd);
+        }
+    }
+    closedir(directory);
 }
\ No newline at end of file
@@ -16,33 +16,73 @@
 #define _COMMAND_HANDLER_HPP
 
 #include <cerrno>
+#include <csignal>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
 #include <iostream>
+#include <iterator>
+#include <string>
 #include <sys/wait.h>
 #include <unistd.h>
 
+#include "env_snapshot.hpp"
+#include "job_monitor.hpp"
 #include "param.hpp"
+#include "resource_limits.hpp"
 
 /**
  * @brief The CommandHandler class manages the execution of shell commands.
  * 
  * This class is responsible for executing parsed commands by forking new processes 
- * and invoking system calls like `execvp()`. 
+ * and invoking system calls like `execvpe()`. 
  * It also handles input/output redirection, background execution of processes, 
- * and the "exit" command to terminate the shell session.
+ * the "export"/"unset" commands for the child environment, the "limit" prefix 
+ * for per-job resource limits, and the "exit" command to terminate the shell session.
  */
 class CommandHandler {
     private:
         // The command to terminate the shell session ("exit").
         static constexpr const char* EXIT_COMMAND = "exit";
 
+        // The command to set variables in the child environment ("export").
+        static constexpr const char* EXPORT_COMMAND = "export";
+
+        // The command to remove variables from the child environment ("unset").
+        static constexpr const char* UNSET_COMMAND = "unset";
+
+        // The first descriptor after stdin, stdout and stderr.
+        static constexpr unsigned int FIRST_NON_STDIO_FD = 3;
+
+        // Signals the terminal sends for Ctrl+C and Ctrl+\.
+        static constexpr int TERMINAL_SIGNALS[] = { SIGINT, SIGQUIT };
+
+        // Dispositions of TERMINAL_SIGNALS from before the shell ignored them.
+        struct sigaction savedActions[std::size(TERMINAL_SIGNALS)];
+
+        // Set while the shell ignores TERMINAL_SIGNALS.
+        bool ignoringSignals = false;
+
+        // Bytes read per read() call while reading command lines.
+        static constexpr size_t INPUT_CHUNK_SIZE = 4096;
+
+        // Input read past the end of the last command line.
+        std::string pendingInput;
+
+        // Cached environment handed to every spawned child.
+        EnvSnapshot environment;
+
+        // Tracks jobs started with "limit" and enforces their timeouts.
+        JobMonitor monitor;
+
         /**
          * @brief Handles the shell exit process.
          * 
          * This method waits for any remaining child processes to finish (reaping 
-         * any background processes), then terminates the shell by calling exit().
+         * any background processes and enforcing the timeouts of limited jobs), 
+         * then terminates the shell by calling exit().
          */
         void exitProcess();
 
@@ -70,19 +110,106 @@ class CommandHandler {
          */
         void redirectOutput(Param& param);
 
+        /**
+         * @brief Handles the "export NAME=VALUE ..." command.
+         * 
+         * Each argument is split on its first '=' and stored in the environment 
+         * snapshot, which is only rebuilt when a value actually changes.
+         * 
+         * @param args The null-terminated argument array, starting with "export".
+         * @return true if every argument was a valid definition, false otherwise.
+         */
+        bool exportVariables(char** args);
+
+        /**
+         * @brief Handles the "unset NAME ..." command.
+         * 
+         * @param args The null-terminated argument array, starting with "unset".
+         */
+        void unsetVariables(char** args);
+
+        /**
+         * @brief Ignores or restores Ctrl+C and Ctrl+\ in the shell.
+         * 
+         * The shell ignores them while it tracks limited jobs, so it can't be 
+         * interrupted and leave those jobs running past their timeouts. 
+         * Children restore the previous dispositions before exec.
+         * 
+         * @param ignore true to ignore the signals, false to restore them.
+         */
+        void ignoreTerminalSignals(bool ignore);
+
+        /**
+         * @brief Makes a process group the terminal's foreground group.
+         * 
+         * Used to hand the terminal to a foreground job that runs in its own process 
+         * group and to take it back afterwards. SIGTTOU is blocked during the call, 
+         * so the mask the child inherits across exec is left unchanged.
+         * 
+         * @param pgid The process group that receives the terminal.
+         */
+        static void setTerminalOwner(pid_t pgid);
+
+        /**
+         * @brief Keeps the shell's descriptors from leaking into the child.
+         * 
+         * This method marks every descriptor above stderr close-on-exec with a single 
+         * close_range() call, so only stdin, stdout and stderr survive the exec. 
+         * If the kernel doesn't support the close-on-exec flag, the descriptors are 
+         * closed with a plain close_range() instead, and without close_range() the 
+         * open descriptors listed in /proc/self/fd are closed one by one.
+         */
+        void closeInheritedDescriptors();
+
     public:
+        // Wait status reported for commands that succeed without a child to wait for.
+        static constexpr int SUCCESS_STATUS = 0;
+
+        // Wait status reported when the shell itself rejects or fails to start a command.
+        static constexpr int FAILURE_STATUS = W_EXITCODE(EXIT_FAILURE, 0);
+
         /**
          * @brief Executes the parsed command.
          * 
          * This method forks a new process to execute the command passed via the Param object.
          * It checks for the "exit" command, handles input/output redirection, and manages 
          * background processes. 
+         * If the command starts with the "limit" prefix, its rlimits are applied in the 
+         * child before exec and the job is handed to the JobMonitor. 
          * The parent process either waits for the child process to complete or 
          * runs the child process in the background.
          * 
          * @param param The Param object containing the parsed command and its associated arguments.
+         * @return The wait status of a foreground command. Background jobs and successful 
+         *         built-ins report 0; commands the shell rejects report exit status 1.
+         */
+        int execute(Param& param);
+
+        /**
+         * @brief Sets a variable in the environment of child processes.
+         * 
+         * @param name The variable name.
+         * @param value The variable value.
+         */
+        void setVariable(const std::string& name, const std::string& value);
+
+        /**
+         * @brief Reads the next command line while enforcing job timeouts.
+         * 
+         * Input is read straight from the descriptor, so poll() sees every pending 
+         * byte and the wait for input can service limited jobs, for terminals, pipes 
+         * and files alike. Bytes after the newline are kept for the next call.
+         * 
+         * @param inputFd The descriptor commands are read from.
+         * @param line Receives the command line without its newline.
+         * @return true if a line was read, false at the end of input.
+         */
+        bool readLine(int inputFd, std::string& line);
+
+        /**
+         * @brief Waits for every limited job to exit, enforcing their timeouts.
          */
-        void execute(Param& param);
+        void finishJobs();
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,92 @@
+/**
+ * @file env_snapshot.cpp
+ * @brief Implementation of the EnvSnapshot class for caching the child environment.
+ *
+ * This file provides the implementation of the EnvSnapshot class, which copies the
+ * shell's environment once and keeps a prebuilt envp array for spawned children.
+ *
+ * @author Noah Nickles
+ * @author Dylan Stephens
+ * @date 10/19/2026
+ * @details Course COP4634
+ */
+
+#include "env_snapshot.hpp"
+
+#include <cstring>
+
+extern char** environ;
+
+EnvSnapshot::EnvSnapshot() {
+    dirty    = true;
+    captured = false;
+}
+
+void EnvSnapshot::capture() {
+    if(captured) return;
+    captured = true;
+
+    // Copy each "NAME=VALUE" entry of the inherited environment.
+    for(char** entry = environ; *entry != nullptr; entry++) {
+        const char* separator = std::strchr(*entry, '=');
+        if(separator == nullptr) continue; // Skip malformed entries.
+
+        std::string name(*entry, separator - *entry);
+        variables.emplace(name, separator + 1);
+    }
+}
+
+void EnvSnapshot::setVariable(const std::string& name, const std::string& value) {
+    capture();
+
+    auto it = variables.find(name);
+
+    // Nothing changed, keep the current envp array.
+    if(it != variables.end() && it->second == value) return;
+
+    variables[name] = value;
+    if(name == PATH_VARIABLE) {
+        setenv(name.c_str(), value.c_str(), 1);
+    }
+    dirty = true;
+}
+
+void EnvSnapshot::unsetVariable(const std::string& name) {
+    capture();
+
+    // Unknown variable, keep the current envp array.
+    if(variables.erase(name) == 0) return;
+
+    if(name == PATH_VARIABLE) {
+        unsetenv(name.c_str());
+    }
+    dirty = true;
+}
+
+char* const* EnvSnapshot::getEnvp() {
+    capture();
+    if(dirty) {
+        rebuild();
+    }
+    return envp.data();
+}
+
+void EnvSnapshot::rebuild() {
+    entries.clear();
+    entries.reserve(variables.size());
+
+    // Build the "NAME=VALUE" strings first so their storage no longer moves.
+    for(const auto& variable : variables) {
+        entries.push_back(variable.first + "=" + variable.second);
+    }
+
+    // Point envp at each entry and append the null-terminator.
+    envp.clear();
+    envp.reserve(entries.size() + 1);
+    for(std::string& entry : entries) {
+        envp.push_back(&entry[0]);
+    }
+    envp.push_back(nullptr);
+
+    dirty = false;
+}
@@ -0,0 +1,104 @@
+/**
+ * @file env_snapshot.hpp
+ * @brief Declares the EnvSnapshot class for caching the child environment.
+ *
+ * This file provides the declaration of the EnvSnapshot class, which keeps a
+ * prebuilt, null-terminated envp array that is handed to every spawned child.
+ * The array is only rebuilt when one of the shell's variables changes.
+ *
+ * @author Noah Nickles
+ * @author Dylan Stephens
+ * @date 10/19/2026
+ * @details Course COP4634
+ */
+
+#ifndef _ENV_SNAPSHOT_HPP
+#define _ENV_SNAPSHOT_HPP
+
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * @brief The EnvSnapshot class caches the environment passed to child processes.
+ *
+ * The shell's environment is copied into a variable map on first use, so startup
+ * doesn't pay for it. The envp array built from that map is immutable between
+ * changes, so launching a command costs nothing beyond handing the cached pointer
+ * to `execvpe()`.
+ */
+class EnvSnapshot {
+    private:
+        // The variable execvpe() reads from the shell's own environment.
+        static constexpr const char* PATH_VARIABLE = "PATH";
+
+        // Shell variables exported to children (name -> value).
+        std::map<std::string, std::string> variables;
+
+        // Backing storage for the "NAME=VALUE" strings referenced by envp.
+        std::vector<std::string> entries;
+
+        // Null-terminated array of pointers into entries.
+        std::vector<char*> envp;
+
+        // Set when a variable changed since the envp array was last built.
+        bool dirty;
+
+        // Set once the process environment has been copied into the variable map.
+        bool captured;
+
+        /**
+         * @brief Copies the process environment into the variable map on first use.
+         */
+        void capture();
+
+        /**
+         * @brief Rebuilds the envp array from the variable map.
+         *
+         * This method regenerates every "NAME=VALUE" entry and the pointer array
+         * that references them, then clears the dirty flag.
+         */
+        void rebuild();
+
+    public:
+        /**
+         * @brief Constructs an empty snapshot of the process environment.
+         *
+         * Nothing is copied until the snapshot is first used.
+         */
+        EnvSnapshot();
+
+        /**
+         * @brief Sets or replaces an exported variable.
+         *
+         * `PATH` is also updated in the shell's own environment, since that is
+         * where `execvpe()` looks it up. Other variables are kept out of it because
+         * each setenv() call scans the whole environment.
+         * Assigning a variable its current value does not invalidate the snapshot.
+         *
+         * @param name The variable name.
+         * @param value The variable value.
+         */
+        void setVariable(const std::string& name, const std::string& value);
+
+        /**
+         * @brief Removes an exported variable.
+         *
+         * @param name The variable name; unknown names are ignored.
+         */
+        void unsetVariable(const std::string& name);
+
+        /**
+         * @brief Retrieves the cached envp array.
+         *
+         * The array is rebuilt first if any variable changed since the last call.
+         *
+         * @note The returned pointer is invalidated by the next variable change.
+         *
+         * @return A null-terminated array of "NAME=VALUE" strings.
+         */
+        char* const* getEnvp();
+};
+
+#endif
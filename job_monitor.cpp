@@ -0,0 +1,184 @@
+/**
+ * @file job_monitor.cpp
+ * @brief Implementation of the JobMonitor class for enforcing job timeouts.
+ *
+ * This file provides the implementation of the JobMonitor class, which multiplexes
+ * the pidfd and timerfd of every tracked job with poll(), escalates timed out jobs
+ * from SIGTERM to SIGKILL, and reports each job's limits when it is reaped.
+ *
+ * @author Noah Nickles
+ * @author Dylan Stephens
+ * @date 10/19/2026
+ * @details Course COP4634
+ */
+
+#include "job_monitor.hpp"
+
+JobMonitor::~JobMonitor() {
+    for(Job& job : jobs) {
+        close(job.pidfd);
+        if(job.timerfd >= 0) close(job.timerfd);
+    }
+}
+
+bool JobMonitor::track(pid_t pid, const ResourceLimits& limits) {
+    Job job;
+    job.pid           = pid;
+    job.timerfd       = -1;
+    job.timeoutSignal = 0;
+    job.limits        = limits;
+
+    /*
+     * The pidfd refers to this exact process, so signals can't hit a recycled PID.
+     * Called through syscall() since older glibc headers lack the wrappers.
+    */
+    job.pidfd = syscall(SYS_pidfd_open, pid, 0);
+    if(job.pidfd == -1) {
+        std::cerr << "Error: failed to monitor process [PID: " << pid << "] ("
+                  << strerror(errno) << ")\n";
+        return false;
+    }
+
+    if(limits.getTimeout() > 0) {
+        job.timerfd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+        if(job.timerfd == -1) {
+            std::cerr << "Error: failed to create timer for [PID: " << pid << "] ("
+                      << strerror(errno) << ")\n";
+        }
+        else {
+            armTimer(job.timerfd, limits.getTimeout());
+        }
+    }
+
+    jobs.push_back(job);
+    return true;
+}
+
+bool JobMonitor::hasJobs() const {
+    return !jobs.empty();
+}
+
+int JobMonitor::wait(pid_t pid) {
+    int status = 0;
+
+    // Keep servicing every job until the requested one has been reaped.
+    auto isTracked = [this, pid]() {
+        for(const Job& job : jobs) {
+            if(job.pid == pid) return true;
+        }
+        return false;
+    };
+    while(isTracked()) {
+        dispatch(-1, -1, pid, &status);
+    }
+    return status;
+}
+
+void JobMonitor::waitForInput(int inputFd) {
+    while(!dispatch(inputFd, -1, -1, nullptr)) {}
+}
+
+void JobMonitor::waitAll() {
+    while(!jobs.empty()) {
+        dispatch(-1, -1, -1, nullptr);
+    }
+}
+
+bool JobMonitor::dispatch(int inputFd, int timeoutMs, pid_t target, int* targetStatus) {
+    std::vector<pollfd> fds;
+
+    // Input first, then a pidfd and timerfd pair per job (poll ignores negative fds).
+    if(inputFd >= 0) {
+        fds.push_back({ inputFd, POLLIN, 0 });
+    }
+    size_t first = fds.size();
+    for(const Job& job : jobs) {
+        fds.push_back({ job.pidfd, POLLIN, 0 });
+        fds.push_back({ job.timerfd, POLLIN, 0 });
+    }
+
+    if(::poll(fds.data(), fds.size(), timeoutMs) <= 0) {
+        return false; // Timed out or interrupted by a signal.
+    }
+
+    // Walk backwards so reaped jobs can be erased in place.
+    for(size_t i = jobs.size(); i-- > 0;) {
+        const pollfd& exited = fds[first + 2 * i];
+        const pollfd& timer  = fds[first + 2 * i + 1];
+
+        if(exited.revents & POLLIN) {
+            int status = reap(jobs[i]);
+            if(jobs[i].pid == target && targetStatus != nullptr) {
+                *targetStatus = status;
+            }
+            jobs.erase(jobs.begin() + i);
+        }
+        else if(timer.revents & POLLIN) {
+            handleTimeout(jobs[i]);
+        }
+    }
+
+    return inputFd >= 0 && (fds[0].revents & (POLLIN | POLLHUP)) != 0;
+}
+
+void JobMonitor::handleTimeout(Job& job) {
+    // Drain the expiration count so the timer stops polling as readable.
+    uint64_t expirations;
+    if(read(job.timerfd, &expirations, sizeof(expirations)) == -1) return;
+
+    if(job.timeoutSignal == 0) {
+        // Ask the job to terminate and give it a grace period to clean up.
+        job.timeoutSignal = SIGTERM;
+        armTimer(job.timerfd, GRACE_PERIOD_SECONDS);
+    }
+    else {
+        // The grace period expired, the job can't ignore SIGKILL.
+        job.timeoutSignal = SIGKILL;
+    }
+    /*
+     * Signal the job's whole process group. The leader is unreaped while it is 
+     * tracked, so its PID (and group ID) can't have been recycled. 
+     * Fall back to the pidfd if the group couldn't be created.
+    */
+    if(syscall(SYS_pidfd_send_signal, job.pidfd, 0, nullptr, 0) == 0
+       && kill(-job.pid, job.timeoutSignal) == 0) {
+        // A stopped job (e.g. by Ctrl+Z) only acts on SIGTERM once it is continued.
+        kill(-job.pid, SIGCONT);
+        return;
+    }
+    syscall(SYS_pidfd_send_signal, job.pidfd, job.timeoutSignal, nullptr, 0);
+    syscall(SYS_pidfd_send_signal, job.pidfd, SIGCONT, nullptr, 0);
+}
+
+int JobMonitor::reap(Job& job) {
+    int status = 0;
+    waitpid(job.pid, &status, 0);
+
+    close(job.pidfd);
+    if(job.timerfd >= 0) close(job.timerfd);
+
+    // Jobs without limits are only tracked to be waited on, keep them quiet.
+    if(!job.limits.isSet()) return status;
+
+    std::cout << "[PID: " << job.pid << "] ";
+    if(WIFSIGNALED(status)) {
+        int signal = WTERMSIG(status);
+        std::cout << "killed by signal " << signal
+                  << " (" << strsignal(signal) << ")";
+        if(job.timeoutSignal != 0) {
+            std::cout << " after exceeding its timeout";
+        }
+    }
+    else {
+        std::cout << "exited with status " << WEXITSTATUS(status);
+    }
+    std::cout << " [limits: " << job.limits.describe() << "]\n";
+
+    return status;
+}
+
+void JobMonitor::armTimer(int timerfd, unsigned long long seconds) {
+    struct itimerspec spec = {};
+    spec.it_value.tv_sec = seconds;
+    timerfd_settime(timerfd, 0, &spec, nullptr);
+}
@@ -0,0 +1,153 @@
+/**
+ * @file job_monitor.hpp
+ * @brief Declares the JobMonitor class for enforcing job timeouts.
+ *
+ * This file provides the declaration of the JobMonitor class, which watches jobs
+ * started with the "limit" prefix through a pidfd and a timerfd per job, enforces
+ * their wall-clock timeout, and reports their limits when they are reaped.
+ *
+ * @author Noah Nickles
+ * @author Dylan Stephens
+ * @date 10/19/2026
+ * @details Course COP4634
+ */
+
+#ifndef _JOB_MONITOR_HPP
+#define _JOB_MONITOR_HPP
+
+#include <cerrno>
+#include <csignal>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <poll.h>
+#include <sys/syscall.h>
+#include <sys/timerfd.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+#include "resource_limits.hpp"
+
+/**
+ * @brief The JobMonitor class enforces wall-clock timeouts on tracked jobs.
+ *
+ * Every tracked job owns a pidfd that becomes readable when the process exits and,
+ * if it has a timeout, a timerfd. When the timer expires the job's process group is
+ * sent SIGTERM (and SIGCONT, so a stopped job can act on it) and the timer is re-armed
+ * for a grace period, after which the group is sent SIGKILL. Timed jobs lead their own process group, so any processes they
+ * started are signaled too.
+ * All waiting is done with poll() over these descriptors, so the shell never blocks
+ * on a single timer.
+ */
+class JobMonitor {
+    private:
+        // Seconds between SIGTERM and SIGKILL for a timed out job.
+        static constexpr int GRACE_PERIOD_SECONDS = 2;
+
+        /**
+         * @brief State of a single tracked job.
+         */
+        struct Job {
+            // Process ID of the job.
+            pid_t pid;
+
+            // Descriptor that becomes readable when the job exits.
+            int pidfd;
+
+            // Timeout timer descriptor or -1 if the job has no timeout.
+            int timerfd;
+
+            // Signal sent by the timeout so far (0, SIGTERM or SIGKILL).
+            int timeoutSignal;
+
+            // Limits the job was started with.
+            ResourceLimits limits;
+        };
+
+        // Jobs that have not been reaped yet.
+        std::vector<Job> jobs;
+
+        /**
+         * @brief Polls the input descriptor and every job descriptor once.
+         *
+         * Expired timers escalate their job's signal and exited jobs are reaped.
+         *
+         * @param inputFd Descriptor to watch for input, or -1 for none.
+         * @param timeoutMs Maximum milliseconds to wait, or -1 to wait indefinitely.
+         * @param target Job whose wait status is wanted, or -1 for none.
+         * @param targetStatus Receives the wait status of target if it was reaped.
+         * @return true if inputFd is readable, false otherwise.
+         */
+        bool dispatch(int inputFd, int timeoutMs, pid_t target, int* targetStatus);
+
+        /**
+         * @brief Sends the next timeout signal to a job and re-arms its timer.
+         *
+         * @param job The job whose timer expired.
+         */
+        void handleTimeout(Job& job);
+
+        /**
+         * @brief Reaps an exited job and reports its status and limits.
+         *
+         * @param job The job whose pidfd became readable.
+         * @return The wait status of the job.
+         */
+        int reap(Job& job);
+
+        /**
+         * @brief Arms a one-shot timer.
+         *
+         * @param timerfd The timer descriptor.
+         * @param seconds Seconds until the timer expires.
+         */
+        static void armTimer(int timerfd, unsigned long long seconds);
+
+    public:
+        /**
+         * @brief Closes the descriptors of every remaining job.
+         */
+        ~JobMonitor();
+
+        /**
+         * @brief Starts tracking a job.
+         *
+         * Opens a pidfd for the process and, if the limits include a timeout,
+         * a timerfd armed to expire after it.
+         *
+         * @param pid The process ID of the job.
+         * @param limits The limits the job was started with.
+         * @return true if the job is tracked, false if its pidfd could not be opened.
+         */
+        bool track(pid_t pid, const ResourceLimits& limits);
+
+        /**
+         * @brief Checks whether any job is being tracked.
+         *
+         * @return true if at least one job has not been reaped, false otherwise.
+         */
+        bool hasJobs() const;
+
+        /**
+         * @brief Waits for a tracked job to exit while servicing every other job.
+         *
+         * @param pid The process ID of a tracked job.
+         * @return The wait status of the job.
+         */
+        int wait(pid_t pid);
+
+        /**
+         * @brief Waits until a descriptor is readable while servicing every job.
+         *
+         * @param inputFd The descriptor to wait for.
+         */
+        void waitForInput(int inputFd);
+
+        /**
+         * @brief Waits for every tracked job to exit, enforcing their timeouts.
+         */
+        void waitAll();
+};
+
+#endif
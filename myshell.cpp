@@ -13,6 +13,9 @@
 
 #include <cstring>
 #include <iostream>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
 
 #include "param.hpp"
 #include "parse.hpp"
@@ -23,8 +26,8 @@ static constexpr const char* PROMPT     = "$$$ ";
 // Stores the format of the flag that enables debug mode.
 static constexpr const char* DEBUG_FLAG = "-Debug";
 
-// Stores the maximum char length of a single command.
-static constexpr int MAX_COMMAND_LENGTH = 256;
+// Stores the format of the flag that runs a single command and exits.
+static constexpr const char* COMMAND_FLAG = "-c";
 
 /**
  * @brief Checks if the debug flag is present in the program arguments.
@@ -42,6 +45,51 @@ bool isDebugMode(int argc, char** argv) {
     return false;
 }
 
+/**
+ * @brief Finds the command passed with the command flag.
+ * 
+ * @param argc Number of arguments passed to the program.
+ * @param argv Array of argument strings.
+ * @return The argument following the command flag, or nullptr if there is none.
+ */
+const char* getCommandArgument(int argc, char** argv) {
+    for(int i = 1; i < argc - 1; i++) {
+        if(std::strcmp(argv[i], COMMAND_FLAG) == 0) {
+            return argv[i + 1];
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Runs a single command without prompting, as with `myshell -c command`.
+ * 
+ * Waits for any limited jobs the command started before returning.
+ * 
+ * @param debug Flag to enable or disable debug mode.
+ * @param parser Reference to the Parse object for command parsing.
+ * @param command The command string to run.
+ * @return The command's exit status, or 128 plus the signal number that killed it.
+ */
+int runCommand(bool debug, Parse& parser, const char* command) {
+    Param param;
+
+    // Copy the command since parsing tokenizes it in place.
+    std::string buffer = command;
+    int status = parser.parseCommand(&buffer[0], param);
+
+    if(debug) {
+        param.printParams();
+    }
+    parser.finishJobs();
+
+    // Report the status the way other shells do.
+    if(WIFSIGNALED(status)) {
+        return 128 + WTERMSIG(status);
+    }
+    return WEXITSTATUS(status);
+}
+
 /**
  * @brief Main program loop to run the shell.
  * 
@@ -58,20 +106,22 @@ bool isDebugMode(int argc, char** argv) {
 void run(bool debug, Parse& parser) {
     while(true) {
         Param param;
-        char command[MAX_COMMAND_LENGTH];
+        // Commands have no length limit, the line grows to fit the input.
+        std::string command;
 
-        // Prompt user and read input.
-        std::cout << PROMPT;
-        std::cin.getline(command, MAX_COMMAND_LENGTH);
+        // Prompt user, then read input while enforcing job timeouts.
+        std::cout << PROMPT << std::flush;
 
         // Prevent Crtl+D (close input) from causing infinite loop.
-        if(!std::cin) {
+        if(!parser.readCommand(STDIN_FILENO, command)) {
+            // Limited jobs must not outlive their timeouts.
+            parser.finishJobs();
             std::cerr << "exiting...\n";
             break;
         }
 
         // Parse the user input.
-        parser.parseCommand(command, param);
+        parser.parseCommand(&command[0], param);
 
         // Print param info if debug flag is enabled.
         if(debug) {
@@ -85,11 +135,12 @@ void run(bool debug, Parse& parser) {
  * 
  * Initializes the parser and determines whether debug mode is active.
  * 
- * The main program loop is executed until the user exits the shell.
+ * If a command is passed with the command flag, only that command is run. 
+ * Otherwise the main program loop is executed until the user exits the shell.
  * 
  * @param argc Number of command-line arguments.
  * @param argv Array of command-line argument strings.
- * @return int Exit status code, 0 for success.
+ * @return int Exit status code, 0 for success, or the command's status with the command flag.
  */
 int main(int argc, char** argv) {
     // Creates a new parser object.
@@ -98,6 +149,12 @@ int main(int argc, char** argv) {
     // Determines if debug mode is enabled based on program arguments.
     bool debug = isDebugMode(argc, argv);
 
+    // Run a single command if one was passed with the command flag.
+    const char* command = getCommandArgument(argc, argv);
+    if(command != nullptr) {
+        return runCommand(debug, parser, command);
+    }
+
     // Start main program loop and pass in debug and parser instance.
     run(debug, parser);
 
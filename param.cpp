@@ -18,34 +18,23 @@ Param::Param() {
 	inputRedirect  = nullptr; 
 	outputRedirect = nullptr;
 	background 	   = 0;
-	argumentCount  = 0;
 }
 
 void Param::addArgument(char* newArgument) {
 	// Return early if argument is null.
 	if(newArgument == nullptr) return;
 
-	// Ensure args aren't more than MAXARGS.
-	if(argumentCount < MAXARGS) {
-		/*
-		 * Increment argumentCount and add associated
-		 * arg at the argumentVector's argumentCount element.
-		*/
-		argumentVector[argumentCount++] = newArgument;
-	} 
-	else {
-		cerr << "Error: Too many arguments. Maximum allowed is " 
-			 << MAXARGS 
-			 << "\n";
-	}
+	// Append the arg, there is no limit on the number of args.
+	argumentVector.push_back(newArgument);
 }
 
 char** Param::getArguments() {
-	// Create arg array with argumentCount + 1 for null-terminator.
+	// Create arg array with argument count + 1 for null-terminator.
+	size_t argumentCount = argumentVector.size();
 	char** args = new char*[argumentCount + 1];
 
-	// Copy arguments from argumentVector[] into args[].
-	for(int i = 0; i < argumentCount; i++) {
+	// Copy arguments from argumentVector into args[].
+	for(size_t i = 0; i < argumentCount; i++) {
 		args[i] = argumentVector[i];
 	}
 
@@ -94,11 +83,11 @@ void Param::printParams() {
 		 << "]" 
 		 << endl 
 		 << "ArgumentCount: [" 
-		 << argumentCount 
+		 << argumentVector.size() 
 		 << "]" 
 		 << endl;
 
-	for(int i = 0; i < argumentCount; i++)
+	for(size_t i = 0; i < argumentVector.size(); i++)
 		cout << "ArgumentVector[" 
 			 << i 
 			 << "]: [" 
@@ -14,10 +14,8 @@
 #ifndef _PARAM_HPP
 #define _PARAM_HPP
 
-/// @brief Maximum number of argument tokens allowed.
-#define MAXARGS 32
-
 #include <iostream>
+#include <vector>
 
 /**
  * @brief Class to hold input data for shell commands.
@@ -36,11 +34,8 @@ class Param {
 		// Background execution flag (0 for false, 1 for true).
 		int background;              
 
-		// Number of arguments passed to the command (similar to argc).
-		int argumentCount;           
-
-		// Array of strings containing the command's arguments.
-		char *argumentVector[MAXARGS]; 
+		// Strings containing the command's arguments; grows with the command.
+		std::vector<char*> argumentVector; 
 		
 	public:
 		/**
@@ -14,39 +14,113 @@
 
 #include "parse.hpp"
 
-void Parse::parseCommand(char* command, Param& param) {
-    // Tokenize the input command string using delimiters (space or tab).
-    char* token = std::strtok(command, DELIM);
+int Parse::parseCommand(char* command, Param& param) {
+    // Load the rc file on first use rather than at startup.
+    if(!rcLoaded) {
+        loadRc();
+    }
+
+    // A new top-level command, the previous command's Param is no longer used.
+    if(expanding.empty()) {
+        aliasExpansions.clear();
+    }
 
-    // Class to handle the parsed input.
-    CommandHandler handler;
+    // Aliases and functions are handled by parsing their expansion instead.
+    int status = 0;
+    if(expandCommand(command, param, status)) return status;
+
+    // Tokenize the input command string using delimiters (space or tab).
+    Tokenizer tokenizer(command);
+    char* token = tokenizer.next();
 
     // No tokens found, return early.
-    if(token == nullptr) return;
+    if(token == nullptr) return status;
 
     // Process each token in the command string.
     while(token != nullptr) {
-        if(token[0] == IN_REDIRECT_FLAG) {
-            parseInputRedirection(token, param);
+        // One table lookup sends ordinary tokens past the operator checks.
+        if(!Tokenizer::is(token[0], OPERATOR_CLASS)) {
+            param.addArgument(token); // Add the token as an argument.
+        }
+        else if(token[0] == IN_REDIRECT_FLAG) {
+            parseInputRedirection(token, tokenizer, param);
         }
         else if(token[0] == OUT_REDIRECT_FLAG) {
-            parseOutputRedirection(token, param);
+            parseOutputRedirection(token, tokenizer, param);
         }
         else if(std::strcmp(token, BACKGROUND_FLAG) == 0) {
-            parseBackgroundProcess(token, param);
+            parseBackgroundProcess(token, tokenizer, param);
             break; // '&' is the last token, so stop processing.
         }
         else {
             param.addArgument(token); // Add the token as an argument.
         }
         // Continue to the next token.
-        token = std::strtok(nullptr, DELIM);
+        token = tokenizer.next();
     }
     // Execute the command after parsing.
-    handler.execute(param);
+    return handler.execute(param);
+}
+
+bool Parse::readCommand(int inputFd, std::string& command) {
+    return handler.readLine(inputFd, command);
+}
+
+void Parse::finishJobs() {
+    handler.finishJobs();
+}
+
+void Parse::loadRc() {
+    rcLoaded = true;
+    rc.load();
+
+    for(const auto& variable : rc.getVariables()) {
+        handler.setVariable(variable.first, variable.second);
+    }
+}
+
+bool Parse::expandCommand(char* command, Param& param, int& status) {
+    // Find the first word without modifying the command string.
+    const char* end   = command + std::strlen(command);
+    const char* start = Tokenizer::scan(command, end, false);
+    const char* stop  = Tokenizer::scan(start, end, true);
+    if(start == stop) return false;
+
+    std::string name(start, stop);
+    for(const std::string& active : expanding) {
+        if(active == name) return false; // Already expanding, use the plain command.
+    }
+
+    const std::string* alias = rc.findAlias(name);
+    const std::vector<std::string>* function = rc.findFunction(name);
+    if(alias == nullptr && function == nullptr) return false;
+
+    expanding.push_back(name);
+    if(alias != nullptr) {
+        // Replace the alias name with its text and keep the remaining arguments.
+        aliasExpansions.push_back(*alias + stop);
+        status = parseCommand(&aliasExpansions.back()[0], param);
+    }
+    else if(Tokenizer::scan(stop, end, false) != end) {
+        // Functions run their body as written and take no arguments or redirections.
+        std::cerr << "Error: function \'" << name
+                  << "\' takes no arguments or redirections\n";
+        status = CommandHandler::FAILURE_STATUS;
+    }
+    else {
+        // Run each body line as its own command; parsing needs a writable copy.
+        for(const std::string& line : *function) {
+            std::string body = line;
+            Param bodyParam;
+            status = parseCommand(&body[0], bodyParam);
+        }
+    }
+    expanding.pop_back();
+
+    return true;
 }
 
-void Parse::parseInputRedirection(char* &token, Param &param) {
+void Parse::parseInputRedirection(char* &token, Tokenizer &tokenizer, Param &param) {
     // Check if input redirection is combined with the filename (e.g., "<file").
     if(token != nullptr && std::strlen(token) > 1) {
         param.setInputRedirect(token + 1); // Skip the '<' character.
@@ -54,7 +128,7 @@ void Parse::parseInputRedirection(char* &token, Param &param) {
     }
 
     // Handle the case where there's a space between '<' and the filename.
-    token = std::strtok(nullptr, DELIM);
+    token = tokenizer.next();
     if(token != nullptr) {
         param.setInputRedirect(token); // Set input redirection file.
     }
@@ -63,7 +137,7 @@ void Parse::parseInputRedirection(char* &token, Param &param) {
     }
 }
 
-void Parse::parseOutputRedirection(char* &token, Param &param) {
+void Parse::parseOutputRedirection(char* &token, Tokenizer &tokenizer, Param &param) {
     // Check if output redirection is combined with the filename (e.g., ">file").
     if(token != nullptr && std::strlen(token) > 1) {
         param.setOutputRedirect(token + 1); // Skip the '>' character.
@@ -71,7 +145,7 @@ void Parse::parseOutputRedirection(char* &token, Param &param) {
     }
     
     // Handle the case where there's a space between '>' and the filename.
-    token = std::strtok(nullptr, DELIM);
+    token = tokenizer.next();
     if(token != nullptr) {
         param.setOutputRedirect(token); // Set output redirection file.
     }
@@ -80,9 +154,9 @@ void Parse::parseOutputRedirection(char* &token, Param &param) {
     }
 }
 
-void Parse::parseBackgroundProcess(char* &token, Param &param) {
+void Parse::parseBackgroundProcess(char* &token, Tokenizer &tokenizer, Param &param) {
     // Move to the next token to ensure '&' is the last token.
-    token = std::strtok(nullptr, DELIM);
+    token = tokenizer.next();
     if(token == nullptr) { // '&' must be the final token.
         param.setBackground(1); // Set background execution flag to true.
     }
@@ -16,10 +16,15 @@
 #define _PARSE_HPP
 
 #include <cstring>
+#include <deque>
 #include <iostream>
+#include <string>
+#include <vector>
 
 #include "command_handler.hpp"
 #include "param.hpp"
+#include "rc_state.hpp"
+#include "tokenizer.hpp"
 
 /**
  * @brief Class to parse shell commands and update a Param object.
@@ -28,12 +33,13 @@
  * shell commands. It handles input/output redirection, background
  * execution flags, and checks for the "exit" command. It updates
  * a Param object based on the parsed command.
+ * 
+ * Aliases and functions from the rc file are expanded before a command is parsed.
+ * The rc file is only loaded when the first command is parsed, so starting the 
+ * shell stays cheap.
  */
 class Parse {
     private:
-        // Delimiters for tokenizing the command string (space or tab).
-        static constexpr const char* DELIM = " \t";
-
         // The flag to indicate background execution (`&`).
         static constexpr const char* BACKGROUND_FLAG = "&";
 
@@ -43,6 +49,52 @@ class Parse {
         // The character flag to indicate output redirection (`>`).
         static constexpr char OUT_REDIRECT_FLAG = '>';
 
+        // The flags must be operator characters for the fast path in parseCommand().
+        static_assert(Tokenizer::is(IN_REDIRECT_FLAG, OPERATOR_CLASS)
+                      && Tokenizer::is(OUT_REDIRECT_FLAG, OPERATOR_CLASS)
+                      && Tokenizer::is(BACKGROUND_FLAG[0], OPERATOR_CLASS),
+                      "Parse flags must be listed in OPERATOR_CHARS");
+
+        // Executes parsed commands; kept for the parser's lifetime so its caches persist.
+        CommandHandler handler;
+
+        // Aliases, variables and functions defined in the rc file.
+        RcState rc;
+
+        // Set once the rc file has been loaded.
+        bool rcLoaded = false;
+
+        // Names of the aliases and functions currently being expanded.
+        std::vector<std::string> expanding;
+
+        /*
+         * Alias expansions of the current command. The caller's Param points into 
+         * them, so they are kept until the next top-level command is parsed. 
+         * A deque never moves its elements, so earlier expansions stay valid.
+        */
+        std::deque<std::string> aliasExpansions;
+
+        /**
+         * @brief Loads the rc file and exports its variables to child processes.
+         */
+        void loadRc();
+
+        /**
+         * @brief Expands an alias or runs a function named by the command's first word.
+         * 
+         * An alias is replaced by its text and the result is parsed into param. 
+         * A function runs each line of its body as a separate command; it takes no 
+         * arguments or redirections, so a call with anything after the name is rejected. 
+         * A name is not expanded again while it is being expanded, so an alias may 
+         * refer to a command of the same name.
+         * 
+         * @param command The command string to be parsed.
+         * @param param The Param object to be populated by an alias expansion.
+         * @param status Receives the wait status of the expanded command.
+         * @return true if the command was expanded and has been handled, false otherwise.
+         */
+        bool expandCommand(char* command, Param& param, int& status);
+
         /**
          * @brief Handles input redirection (`<`) for the parsed command.
          * 
@@ -50,9 +102,10 @@ class Parse {
          * and assigns the next token as the input file.
          * 
          * @param token The current token being processed.
+         * @param tokenizer The Tokenizer to read the following token from.
          * @param param The Param object to store the input file information.
          */
-        void parseInputRedirection(char* &token, Param &param);
+        void parseInputRedirection(char* &token, Tokenizer &tokenizer, Param &param);
 
         /**
          * @brief Handles output redirection (`>`) for the parsed command.
@@ -61,9 +114,10 @@ class Parse {
          * and assigns the next token as the output file.
          * 
          * @param token The current token being processed.
+         * @param tokenizer The Tokenizer to read the following token from.
          * @param param The Param object to store the output file information.
          */
-        void parseOutputRedirection(char* &token, Param &param);
+        void parseOutputRedirection(char* &token, Tokenizer &tokenizer, Param &param);
 
         /**
          * @brief Handles background execution flag (`&`) for the parsed command.
@@ -73,9 +127,10 @@ class Parse {
          * executed in the background.
          * 
          * @param token The current token being processed.
+         * @param tokenizer The Tokenizer to read the following token from.
          * @param param The Param object to store the background execution flag.
          */
-        void parseBackgroundProcess(char* &token, Param &param);
+        void parseBackgroundProcess(char* &token, Tokenizer &tokenizer, Param &param);
 
 
     public:
@@ -89,8 +144,23 @@ class Parse {
          * 
          * @param command The command string to be parsed.
          * @param param The Param object to be populated with the parsed data.
+         * @return The wait status of the command, or of the last command of a function.
+         */
+        int parseCommand(char* command, Param& param);
+
+        /**
+         * @brief Reads the next command line while enforcing job timeouts.
+         * 
+         * @param inputFd The descriptor commands are read from.
+         * @param command Receives the command line.
+         * @return true if a command was read, false at the end of input.
+         */
+        bool readCommand(int inputFd, std::string& command);
+
+        /**
+         * @brief Waits for every limited job to exit, enforcing their timeouts.
          */
-        void parseCommand(char* command, Param& param);
+        void finishJobs();
 };
 
 #endif
\ No newline at end of file
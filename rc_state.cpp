@@ -0,0 +1,346 @@
+/**
+ * @file rc_state.cpp
+ * @brief Implementation of the RcState class for loading the shell's rc file.
+ *
+ * This file provides the implementation of the RcState class, which parses the rc
+ * file and keeps its aliases, variables and functions in a binary snapshot that is
+ * validated by the rc file's mtime and hash.
+ *
+ * Snapshot layout (integers in host byte order):
+ *  - magic "MYSHRC01", rc mtime, rc size and rc hash as uint64
+ *  - alias count as uint32, then each name and value
+ *  - variable count as uint32, then each name and value
+ *  - function count as uint32, then each name, its line count as uint32 and its lines
+ * Strings are stored as a uint32 length followed by their bytes.
+ *
+ * @author Noah Nickles
+ * @author Dylan Stephens
+ * @date 10/19/2026
+ * @details Course COP4634
+ */
+
+#include "rc_state.hpp"
+
+namespace {
+    // Keyword that defines an alias.
+    constexpr const char* ALIAS_KEYWORD    = "alias ";
+
+    // Keyword that defines a variable.
+    constexpr const char* EXPORT_KEYWORD   = "export ";
+
+    // Keyword that starts a function definition.
+    constexpr const char* FUNCTION_KEYWORD = "function ";
+
+    // Line that ends a function definition.
+    constexpr const char* FUNCTION_END     = "}";
+
+    /**
+     * @brief Writes a fixed-size integer in host byte order.
+     */
+    template <typename T>
+    void writeInteger(std::ostream& out, T value) {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    /**
+     * @brief Reads a fixed-size integer in host byte order and advances the cursor.
+     */
+    template <typename T>
+    bool readInteger(const char*& in, const char* end, T& value) {
+        if(static_cast<size_t>(end - in) < sizeof(value)) return false;
+        std::memcpy(&value, in, sizeof(value));
+        in += sizeof(value);
+        return true;
+    }
+
+    /**
+     * @brief Writes a length-prefixed string.
+     */
+    void writeString(std::ostream& out, const std::string& value) {
+        writeInteger<uint32_t>(out, value.size());
+        out.write(value.data(), value.size());
+    }
+
+    /**
+     * @brief Reads a length-prefixed string and advances the cursor.
+     */
+    bool readString(const char*& in, const char* end, std::string& value) {
+        uint32_t length;
+        if(!readInteger(in, end, length) || static_cast<size_t>(end - in) < length) return false;
+        value.assign(in, length);
+        in += length;
+        return true;
+    }
+
+    /**
+     * @brief Writes a map of strings as a count followed by name/value pairs.
+     */
+    void writeMap(std::ostream& out, const std::map<std::string, std::string>& map) {
+        writeInteger<uint32_t>(out, map.size());
+        for(const auto& entry : map) {
+            writeString(out, entry.first);
+            writeString(out, entry.second);
+        }
+    }
+
+    /**
+     * @brief Reads a map of strings written by writeMap().
+     */
+    bool readMap(const char*& in, const char* end, std::map<std::string, std::string>& map) {
+        uint32_t count;
+        if(!readInteger(in, end, count)) return false;
+
+        // Each entry takes at least two length prefixes; reject impossible counts.
+        if(count > static_cast<size_t>(end - in) / (2 * sizeof(uint32_t))) return false;
+
+        for(uint32_t i = 0; i < count; i++) {
+            std::string name, value;
+            if(!readString(in, end, name) || !readString(in, end, value)) return false;
+            // Entries were written in order, so each one belongs at the end.
+            map.emplace_hint(map.end(), std::move(name), std::move(value));
+        }
+        return true;
+    }
+
+    /**
+     * @brief Splits "NAME=VALUE" on its first '='.
+     *
+     * @return true if NAME is non-empty, false otherwise.
+     */
+    bool splitDefinition(const std::string& definition, std::string& name, std::string& value) {
+        size_t separator = definition.find('=');
+        if(separator == std::string::npos || separator == 0) return false;
+        name  = definition.substr(0, separator);
+        value = definition.substr(separator + 1);
+        return true;
+    }
+}
+
+void RcState::load() {
+    // Locate the rc file, there is nothing to load without one.
+    std::string path;
+    if(const char* override = std::getenv(RC_PATH_VARIABLE)) {
+        path = override;
+    }
+    else if(const char* home = std::getenv("HOME")) {
+        path = std::string(home) + "/" + RC_FILE_NAME;
+    }
+    struct stat info;
+    if(path.empty() || stat(path.c_str(), &info) == -1) return;
+
+    Fingerprint current;
+    current.mtime = static_cast<uint64_t>(info.st_mtim.tv_sec) * 1000000000ULL + info.st_mtim.tv_nsec;
+    current.size  = info.st_size;
+    current.hash  = 0;
+
+    // Fast path: the rc file is untouched since the snapshot was taken.
+    std::string snapshotPath = path + SNAPSHOT_SUFFIX;
+    std::string snapshot = readFile(snapshotPath);
+    const char* cursor = snapshot.data();
+    const char* end    = cursor + snapshot.size();
+    Fingerprint recorded;
+    bool haveSnapshot = readHeader(cursor, end, recorded);
+    if(haveSnapshot && recorded.mtime == current.mtime && recorded.size == current.size) {
+        if(readBody(cursor, end)) return;
+        haveSnapshot = false;
+    }
+
+    // Read and hash the rc file.
+    std::string contents = readFile(path);
+    current.size = contents.size();
+    current.hash = hash(contents);
+
+    // The rc file was touched but not changed, reuse the state and refresh the mtime.
+    if(haveSnapshot && recorded.hash == current.hash && readBody(cursor, end)) {
+        writeSnapshot(snapshotPath, current);
+        return;
+    }
+
+    parse(contents, path);
+    writeSnapshot(snapshotPath, current);
+}
+
+const std::string* RcState::findAlias(const std::string& name) const {
+    auto it = aliases.find(name);
+    return it != aliases.end() ? &it->second : nullptr;
+}
+
+const std::vector<std::string>* RcState::findFunction(const std::string& name) const {
+    auto it = functions.find(name);
+    return it != functions.end() ? &it->second : nullptr;
+}
+
+const std::map<std::string, std::string>& RcState::getVariables() const {
+    return variables;
+}
+
+void RcState::parse(const std::string& contents, const std::string& path) {
+    std::istringstream in(contents);
+    std::string line;
+    int lineNumber = 0;
+
+    // Body of the function currently being defined, or nullptr outside of one.
+    std::vector<std::string>* function = nullptr;
+
+    while(std::getline(in, line)) {
+        lineNumber++;
+
+        // Trim surrounding whitespace and skip blank lines and comments.
+        size_t start = line.find_first_not_of(" \t\r");
+        if(start == std::string::npos || line[start] == '#') continue;
+        line = line.substr(start, line.find_last_not_of(" \t\r") - start + 1);
+
+        std::string name, value;
+        if(function != nullptr) {
+            if(line == FUNCTION_END) {
+                function = nullptr;
+            }
+            else {
+                function->push_back(line);
+            }
+        }
+        else if(line.compare(0, std::strlen(ALIAS_KEYWORD), ALIAS_KEYWORD) == 0
+                && splitDefinition(line.substr(std::strlen(ALIAS_KEYWORD)), name, value)) {
+            aliases[name] = unquote(value);
+        }
+        else if(line.compare(0, std::strlen(EXPORT_KEYWORD), EXPORT_KEYWORD) == 0
+                && splitDefinition(line.substr(std::strlen(EXPORT_KEYWORD)), name, value)) {
+            variables[name] = unquote(value);
+        }
+        else if(line.compare(0, std::strlen(FUNCTION_KEYWORD), FUNCTION_KEYWORD) == 0
+                && line.back() == '{') {
+            // Take the name between the keyword and the opening brace.
+            name = line.substr(std::strlen(FUNCTION_KEYWORD));
+            name = name.substr(0, name.find_first_of(" \t{"));
+            function = &functions[name];
+            function->clear();
+        }
+        else {
+            std::cerr << "Error: " << path << ":" << lineNumber
+                      << ": ignoring unsupported line \'" << line << "\'\n";
+        }
+    }
+
+    if(function != nullptr) {
+        std::cerr << "Error: " << path << ": missing \'" << FUNCTION_END
+                  << "\' at end of file\n";
+    }
+}
+
+bool RcState::readHeader(const char*& in, const char* end, Fingerprint& fingerprint) {
+    if(static_cast<size_t>(end - in) < SNAPSHOT_MAGIC_LENGTH) return false;
+    if(std::memcmp(in, SNAPSHOT_MAGIC, SNAPSHOT_MAGIC_LENGTH) != 0) return false;
+    in += SNAPSHOT_MAGIC_LENGTH;
+
+    return readInteger(in, end, fingerprint.mtime)
+        && readInteger(in, end, fingerprint.size)
+        && readInteger(in, end, fingerprint.hash);
+}
+
+bool RcState::readBody(const char* in, const char* end) {
+    aliases.clear();
+    variables.clear();
+    functions.clear();
+
+    bool valid = readMap(in, end, aliases) && readMap(in, end, variables);
+
+    // Counts come from a cache file, so check them against the bytes left before using them.
+    uint32_t count = 0;
+    valid = valid && readInteger(in, end, count)
+                  && count <= static_cast<size_t>(end - in) / (2 * sizeof(uint32_t));
+    for(uint32_t i = 0; valid && i < count; i++) {
+        std::string name;
+        uint32_t lines = 0;
+        valid = readString(in, end, name) && readInteger(in, end, lines)
+                && lines <= static_cast<size_t>(end - in) / sizeof(uint32_t);
+        if(!valid) break;
+
+        std::vector<std::string>& body = functions.emplace_hint(functions.end(), name,
+                                                                std::vector<std::string>())->second;
+        body.reserve(lines);
+        for(uint32_t j = 0; valid && j < lines; j++) {
+            body.emplace_back();
+            valid = readString(in, end, body.back());
+        }
+    }
+
+    // Never keep half of a corrupt snapshot.
+    if(!valid) {
+        aliases.clear();
+        variables.clear();
+        functions.clear();
+    }
+    return valid;
+}
+
+void RcState::writeSnapshot(const std::string& path, const Fingerprint& fingerprint) const {
+    std::ostringstream out;
+
+    out.write(SNAPSHOT_MAGIC, SNAPSHOT_MAGIC_LENGTH);
+    writeInteger(out, fingerprint.mtime);
+    writeInteger(out, fingerprint.size);
+    writeInteger(out, fingerprint.hash);
+
+    writeMap(out, aliases);
+    writeMap(out, variables);
+
+    writeInteger<uint32_t>(out, functions.size());
+    for(const auto& function : functions) {
+        writeString(out, function.first);
+        writeInteger<uint32_t>(out, function.second.size());
+        for(const std::string& line : function.second) {
+            writeString(out, line);
+        }
+    }
+
+    /*
+     * Each shell writes its own uniquely named temporary file, so concurrent 
+     * cold starts never write into the file another one is renaming into place.
+    */
+    std::string temporaryPath = path + ".XXXXXX";
+    int fd = mkostemp(&temporaryPath[0], O_CLOEXEC);
+    if(fd == -1) return;
+
+    std::string data = out.str();
+    bool written = write(fd, data.data(), data.size()) == static_cast<ssize_t>(data.size());
+    written = close(fd) == 0 && written;
+
+    // Only replace the old snapshot once the new one is complete.
+    if(!written || std::rename(temporaryPath.c_str(), path.c_str()) != 0) {
+        std::remove(temporaryPath.c_str());
+    }
+}
+
+std::string RcState::readFile(const std::string& path) {
+    std::string contents;
+
+    // Read the whole file with a single read() sized by fstat().
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if(fd == -1) return contents;
+
+    struct stat info;
+    if(fstat(fd, &info) == 0 && info.st_size > 0) {
+        contents.resize(info.st_size);
+        ssize_t length = read(fd, &contents[0], contents.size());
+        contents.resize(length > 0 ? length : 0);
+    }
+    close(fd);
+    return contents;
+}
+
+std::string RcState::unquote(const std::string& value) {
+    if(value.size() >= 2 && (value.front() == '\'' || value.front() == '\"')
+       && value.back() == value.front()) {
+        return value.substr(1, value.size() - 2);
+    }
+    return value;
+}
+
+uint64_t RcState::hash(const std::string& data) {
+    uint64_t result = 14695981039346656037ULL; // FNV-1a offset basis.
+    for(unsigned char byte : data) {
+        result ^= byte;
+        result *= 1099511628211ULL; // FNV-1a prime.
+    }
+    return result;
+}
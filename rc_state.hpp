@@ -0,0 +1,185 @@
+/**
+ * @file rc_state.hpp
+ * @brief Declares the RcState class for loading the shell's rc file.
+ *
+ * This file provides the declaration of the RcState class, which holds the aliases,
+ * variables and functions defined in `~/.myshellrc`. The parsed state is cached in
+ * a binary snapshot next to the rc file so later startups can skip parsing it.
+ *
+ * @author Noah Nickles
+ * @author Dylan Stephens
+ * @date 10/19/2026
+ * @details Course COP4634
+ */
+
+#ifndef _RC_STATE_HPP
+#define _RC_STATE_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+/**
+ * @brief Class to hold the state defined by the rc file.
+ *
+ * Supported rc syntax, one definition per line ('#' starts a comment):
+ *  - alias NAME=VALUE      (VALUE replaces NAME when it is the first word of a command)
+ *  - export NAME=VALUE     (sets a variable in the environment of child processes)
+ *  - function NAME {       (each following line up to a lone '}' is a command run
+ *    ...                    when NAME is entered on its own; functions take no
+ *                           arguments, redirections or '&')
+ *    }
+ *
+ * The rc file is `$MYSHELLRC` if set, otherwise `$HOME/.myshellrc`.
+ * The snapshot is trusted if its recorded mtime and size match the rc file;
+ * otherwise the rc file is hashed and the snapshot is reused if the hash matches.
+ */
+class RcState {
+    private:
+        // Environment variable that overrides the rc file path.
+        static constexpr const char* RC_PATH_VARIABLE = "MYSHELLRC";
+
+        // Name of the rc file in the home directory.
+        static constexpr const char* RC_FILE_NAME     = ".myshellrc";
+
+        // Suffix appended to the rc file path to name its snapshot.
+        static constexpr const char* SNAPSHOT_SUFFIX  = ".snapshot";
+
+        // Magic bytes identifying the snapshot format and version.
+        static constexpr const char* SNAPSHOT_MAGIC   = "MYSHRC01";
+
+        // Length of SNAPSHOT_MAGIC without the null-terminator.
+        static constexpr size_t SNAPSHOT_MAGIC_LENGTH = 8;
+
+        /**
+         * @brief Identifies the rc file a snapshot was built from.
+         */
+        struct Fingerprint {
+            // Modification time of the rc file in nanoseconds.
+            uint64_t mtime;
+
+            // Size of the rc file in bytes.
+            uint64_t size;
+
+            // FNV-1a hash of the rc file contents.
+            uint64_t hash;
+        };
+
+        // Alias names mapped to their replacement text.
+        std::map<std::string, std::string> aliases;
+
+        // Variable names mapped to their values.
+        std::map<std::string, std::string> variables;
+
+        // Function names mapped to the command lines of their bodies.
+        std::map<std::string, std::vector<std::string>> functions;
+
+        /**
+         * @brief Parses rc file contents into aliases, variables and functions.
+         *
+         * Unsupported lines are reported and ignored.
+         *
+         * @param contents The rc file contents.
+         * @param path The rc file path used in error messages.
+         */
+        void parse(const std::string& contents, const std::string& path);
+
+        /**
+         * @brief Reads the fingerprint at the start of a snapshot.
+         *
+         * @param in Cursor into the snapshot, advanced past the header.
+         * @param end End of the snapshot.
+         * @param fingerprint Receives the recorded fingerprint.
+         * @return true if the snapshot has a valid header, false otherwise.
+         */
+        static bool readHeader(const char*& in, const char* end, Fingerprint& fingerprint);
+
+        /**
+         * @brief Reads the aliases, variables and functions following the header.
+         *
+         * On failure all state is cleared.
+         *
+         * @param in Cursor into the snapshot, positioned after the header.
+         * @param end End of the snapshot.
+         * @return true if the whole body was read, false otherwise.
+         */
+        bool readBody(const char* in, const char* end);
+
+        /**
+         * @brief Atomically writes the current state to a snapshot.
+         *
+         * The snapshot is written to a uniquely named temporary file and renamed
+         * into place, so concurrent shells never see a partial snapshot.
+         * Failure is silent since the snapshot is only a cache.
+         *
+         * @param path The snapshot path.
+         * @param fingerprint The fingerprint of the rc file the state came from.
+         */
+        void writeSnapshot(const std::string& path, const Fingerprint& fingerprint) const;
+
+        /**
+         * @brief Reads a whole file into memory.
+         *
+         * @param path The file path.
+         * @return The file contents, or an empty string if it can't be read.
+         */
+        static std::string readFile(const std::string& path);
+
+        /**
+         * @brief Removes a single pair of matching quotes around a value.
+         *
+         * @param value The value to unquote.
+         * @return The value without its surrounding quotes.
+         */
+        static std::string unquote(const std::string& value);
+
+        /**
+         * @brief Computes the 64-bit FNV-1a hash of a string.
+         *
+         * @param data The string to hash.
+         * @return The hash value.
+         */
+        static uint64_t hash(const std::string& data);
+
+    public:
+        /**
+         * @brief Loads the rc file, using its snapshot when it is still valid.
+         *
+         * Does nothing if there is no rc file.
+         */
+        void load();
+
+        /**
+         * @brief Looks up an alias.
+         *
+         * @param name The alias name.
+         * @return The replacement text, or nullptr if no such alias exists.
+         */
+        const std::string* findAlias(const std::string& name) const;
+
+        /**
+         * @brief Looks up a function.
+         *
+         * @param name The function name.
+         * @return The command lines of the body, or nullptr if no such function exists.
+         */
+        const std::vector<std::string>* findFunction(const std::string& name) const;
+
+        /**
+         * @brief Retrieves the variables defined in the rc file.
+         *
+         * @return The variable names mapped to their values.
+         */
+        const std::map<std::string, std::string>& getVariables() const;
+};
+
+#endif
@@ -0,0 +1,177 @@
+/**
+ * @file resource_limits.cpp
+ * @brief Implementation of the ResourceLimits class for the "limit" command prefix.
+ *
+ * This file provides the implementation of the ResourceLimits class, which parses
+ * "limit" options and applies them to a child process with setrlimit().
+ *
+ * @author Noah Nickles
+ * @author Dylan Stephens
+ * @date 10/19/2026
+ * @details Course COP4634
+ */
+
+#include "resource_limits.hpp"
+
+ResourceLimits::ResourceLimits() {
+    memoryBytes    = 0;
+    cpuSeconds     = 0;
+    openFiles      = 0;
+    timeoutSeconds = 0;
+}
+
+int ResourceLimits::parse(char** args) {
+    int i = 1;
+
+    // Consume "--option value" pairs until the first non-option argument.
+    while(args[i] != nullptr && std::strncmp(args[i], "--", 2) == 0) {
+        const char* option = args[i];
+        const char* value  = args[i + 1];
+
+        if(value == nullptr) {
+            std::cerr << "Error: no value specified after \'" << option << "\'\n";
+            return -1;
+        }
+
+        bool valid;
+        if(std::strcmp(option, MEM_OPTION) == 0) {
+            valid = parseValue(value, true, memoryBytes);
+        }
+        else if(std::strcmp(option, CPU_OPTION) == 0) {
+            valid = parseValue(value, false, cpuSeconds);
+        }
+        else if(std::strcmp(option, NOFILE_OPTION) == 0) {
+            valid = parseValue(value, false, openFiles);
+        }
+        else if(std::strcmp(option, TIMEOUT_OPTION) == 0) {
+            valid = parseValue(value, false, timeoutSeconds);
+        }
+        else {
+            std::cerr << "Error: unknown limit option \'" << option << "\'\n";
+            return -1;
+        }
+
+        if(!valid) {
+            std::cerr << "Error: invalid value \'" << value
+                      << "\' for \'" << option << "\'\n";
+            return -1;
+        }
+        i += 2;
+    }
+
+    // A limited command must follow the options.
+    if(args[i] == nullptr) {
+        std::cerr << "Error: no command specified after \'" << LIMIT_COMMAND << "\'\n";
+        return -1;
+    }
+    return i;
+}
+
+void ResourceLimits::apply() const {
+    if(memoryBytes > 0) {
+        applyLimit(RLIMIT_AS, memoryBytes, memoryBytes, MEM_OPTION);
+    }
+    if(cpuSeconds > 0) {
+        applyLimit(RLIMIT_CPU, cpuSeconds, cpuSeconds + 1, CPU_OPTION);
+    }
+    if(openFiles > 0) {
+        applyLimit(RLIMIT_NOFILE, openFiles, openFiles, NOFILE_OPTION);
+    }
+}
+
+bool ResourceLimits::isSet() const {
+    return memoryBytes > 0 || cpuSeconds > 0 || openFiles > 0 || timeoutSeconds > 0;
+}
+
+unsigned long long ResourceLimits::getTimeout() const {
+    return timeoutSeconds;
+}
+
+std::string ResourceLimits::describe() const {
+    std::string description;
+
+    // Appends "name=value" with a separating space when needed.
+    auto append = [&description](const char* name, const std::string& value) {
+        if(!description.empty()) description += ' ';
+        description += name;
+        description += '=';
+        description += value;
+    };
+
+    if(memoryBytes > 0) {
+        // Show the memory limit in the largest unit that divides it evenly.
+        const char* units = "BKMG";
+        unsigned long long size = memoryBytes;
+        while(units[1] != '\0' && size % 1024 == 0) {
+            size /= 1024;
+            units++;
+        }
+        append("mem", std::to_string(size) + *units);
+    }
+    if(cpuSeconds > 0) {
+        append("cpu", std::to_string(cpuSeconds) + "s");
+    }
+    if(openFiles > 0) {
+        append("nofile", std::to_string(openFiles));
+    }
+    if(timeoutSeconds > 0) {
+        append("timeout", std::to_string(timeoutSeconds) + "s");
+    }
+    return description;
+}
+
+bool ResourceLimits::parseValue(const char* text, bool allowSuffix, unsigned long long& result) {
+    // Reject signs and empty strings, which strtoull() would otherwise accept.
+    if(*text < '0' || *text > '9') return false;
+
+    char* end;
+    errno = 0;
+    unsigned long long value = std::strtoull(text, &end, 10);
+    if(errno != 0 || value == 0) return false;
+
+    // Scale by the optional binary size suffix.
+    if(allowSuffix && *end != '\0' && end[1] == '\0') {
+        int shift = 0;
+        switch(*end) {
+            case 'K': case 'k': shift = 10; break;
+            case 'M': case 'm': shift = 20; break;
+            case 'G': case 'g': shift = 30; break;
+            default: return false;
+        }
+        if(value > (~0ULL >> shift)) return false;
+        value <<= shift;
+        end++;
+    }
+
+    if(*end != '\0') return false;
+    result = value;
+    return true;
+}
+
+void ResourceLimits::applyLimit(int resource, rlim_t soft, rlim_t hard, const char* name) {
+    struct rlimit limit;
+    if(getrlimit(resource, &limit) == -1) {
+        std::cerr << "Error: failed to read the limit for \'" << name << "\' ("
+                  << strerror(errno) << ")\n";
+        exit(EXIT_FAILURE);
+    }
+
+    // An unprivileged process can't raise its hard limit, so never ask for more.
+    rlim_t maximum = limit.rlim_max;
+    if(maximum != RLIM_INFINITY && hard > maximum) {
+        hard = maximum;
+    }
+    if(soft > hard) {
+        std::cerr << "Error: \'" << name << "\' value " << soft
+                  << " exceeds the current hard limit of " << hard << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    limit.rlim_cur = soft;
+    limit.rlim_max = hard;
+    if(setrlimit(resource, &limit) == -1) {
+        std::cerr << "Error: failed to apply \'" << name << "\' ("
+                  << strerror(errno) << ")\n";
+        exit(EXIT_FAILURE);
+    }
+}
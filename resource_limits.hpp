@@ -0,0 +1,132 @@
+/**
+ * @file resource_limits.hpp
+ * @brief Declares the ResourceLimits class for the "limit" command prefix.
+ *
+ * This file provides the declaration of the ResourceLimits class, which parses the
+ * options of the "limit" prefix, applies them as rlimits in a child process, and
+ * describes them when the job is reported.
+ *
+ * @author Noah Nickles
+ * @author Dylan Stephens
+ * @date 10/19/2026
+ * @details Course COP4634
+ */
+
+#ifndef _RESOURCE_LIMITS_HPP
+#define _RESOURCE_LIMITS_HPP
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <sys/resource.h>
+
+/**
+ * @brief Class to hold the resource limits of a single job.
+ *
+ * Syntax: limit [--mem SIZE[K|M|G]] [--cpu SECONDS] [--nofile COUNT] [--timeout SECONDS] command ...
+ *
+ * Memory, CPU and descriptor limits are enforced by the kernel through setrlimit().
+ * The wall-clock timeout is enforced by the shell, see JobMonitor.
+ */
+class ResourceLimits {
+    private:
+        // Option that limits the address space size (RLIMIT_AS).
+        static constexpr const char* MEM_OPTION     = "--mem";
+
+        // Option that limits the CPU time in seconds (RLIMIT_CPU).
+        static constexpr const char* CPU_OPTION     = "--cpu";
+
+        // Option that limits the number of open descriptors (RLIMIT_NOFILE).
+        static constexpr const char* NOFILE_OPTION  = "--nofile";
+
+        // Option that limits the wall-clock run time in seconds.
+        static constexpr const char* TIMEOUT_OPTION = "--timeout";
+
+        // Address space limit in bytes or 0 if none is set.
+        unsigned long long memoryBytes;
+
+        // CPU time limit in seconds or 0 if none is set.
+        unsigned long long cpuSeconds;
+
+        // Open descriptor limit or 0 if none is set.
+        unsigned long long openFiles;
+
+        // Wall-clock timeout in seconds or 0 if none is set.
+        unsigned long long timeoutSeconds;
+
+        /**
+         * @brief Parses a positive integer with an optional K, M or G suffix.
+         *
+         * @param text The string to parse.
+         * @param allowSuffix Whether a binary size suffix is accepted.
+         * @param result Receives the parsed value.
+         * @return true if the whole string was a positive value, false otherwise.
+         */
+        static bool parseValue(const char* text, bool allowSuffix, unsigned long long& result);
+
+        /**
+         * @brief Applies a single rlimit, setting soft and hard limits.
+         *
+         * The hard limit is capped at the current hard limit, which an unprivileged
+         * process can't raise. If the soft limit is still above it or the call fails,
+         * it prints an error and terminates the child process.
+         *
+         * @param resource The RLIMIT_* resource to limit.
+         * @param soft The soft limit.
+         * @param hard The hard limit.
+         * @param name The option name used in the error message.
+         */
+        static void applyLimit(int resource, rlim_t soft, rlim_t hard, const char* name);
+
+    public:
+        // The prefix command that introduces resource limits ("limit").
+        static constexpr const char* LIMIT_COMMAND = "limit";
+
+        /**
+         * @brief Constructs an empty ResourceLimits object with no limits set.
+         */
+        ResourceLimits();
+
+        /**
+         * @brief Parses the options following the "limit" prefix.
+         *
+         * @param args The null-terminated argument array, starting with "limit".
+         * @return The index of the limited command in args, or -1 after printing an
+         *         error if an option is invalid or no command follows.
+         */
+        int parse(char** args);
+
+        /**
+         * @brief Applies the memory, CPU and descriptor limits to the calling process.
+         *
+         * Must be called in the child between fork() and exec.
+         * The CPU hard limit is one second above the soft limit, capped at the current
+         * hard limit, so the job receives SIGXCPU before it is killed.
+         */
+        void apply() const;
+
+        /**
+         * @brief Checks whether any limit has been set.
+         *
+         * @return true if at least one option was given, false otherwise.
+         */
+        bool isSet() const;
+
+        /**
+         * @brief Retrieves the wall-clock timeout.
+         *
+         * @return The timeout in seconds, or 0 if none is set.
+         */
+        unsigned long long getTimeout() const;
+
+        /**
+         * @brief Describes the limits that are set, e.g. "mem=64M timeout=5s".
+         *
+         * @return A space-separated description of every set limit.
+         */
+        std::string describe() const;
+};
+
+#endif
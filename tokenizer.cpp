@@ -0,0 +1,206 @@
+/**
+ * @file tokenizer.cpp
+ * @brief Implementation of the Tokenizer class and its classifying kernels.
+ *
+ * This file provides the scalar, SSE2 and AVX2 classifying kernels and the runtime
+ * dispatch between them. Every kernel compares a block against each character of
+ * DELIMITER_CHARS, so they classify bytes exactly like CHAR_CLASS_TABLE does.
+ *
+ * @author Noah Nickles
+ * @author Dylan Stephens
+ * @date 10/19/2026
+ * @details Course COP4634
+ */
+
+#include "tokenizer.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define TOKENIZER_X86 1
+#endif
+
+namespace {
+    /**
+     * @brief Scalar kernel, classifies 8 bytes per word with bit tricks (SWAR).
+     */
+    uint64_t classifyScalar(const char* block) {
+        constexpr uint64_t LOW_BITS  = 0x7F7F7F7F7F7F7F7FULL;
+        constexpr uint64_t HIGH_BITS = 0x8080808080808080ULL;
+        constexpr uint64_t ONES      = 0x0101010101010101ULL;
+
+        uint64_t mask = 0;
+        for(size_t offset = 0; offset < Tokenizer::BLOCK_SIZE; offset += 8) {
+            uint64_t word;
+            std::memcpy(&word, block + offset, sizeof(word));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+            word = __builtin_bswap64(word); // Keep byte i in bits 8i to 8i+7.
+#endif
+            // Set the high bit of each byte that matches one of the delimiter characters.
+            uint64_t hits = 0;
+            for(size_t i = 0; i < DELIMITER_COUNT; i++) {
+                uint64_t x = word ^ (ONES * static_cast<unsigned char>(DELIMITER_CHARS[i]));
+                hits |= ~(((x & LOW_BITS) + LOW_BITS) | x) & HIGH_BITS;
+            }
+
+            // Gather the eight high bits into the low byte, byte i to bit i.
+            mask |= (((hits >> 7) * 0x0102040810204080ULL) >> 56) << offset;
+        }
+        return mask;
+    }
+
+#ifdef TOKENIZER_X86
+    /**
+     * @brief SSE2 kernel, classifies 16 bytes per compare.
+     */
+    __attribute__((target("sse2")))
+    uint64_t classifySse2(const char* block) {
+        uint64_t mask = 0;
+        for(size_t offset = 0; offset < Tokenizer::BLOCK_SIZE; offset += 16) {
+            __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + offset));
+
+            // Set each byte that matches one of the delimiter characters.
+            __m128i hits = _mm_setzero_si128();
+            for(size_t i = 0; i < DELIMITER_COUNT; i++) {
+                hits = _mm_or_si128(hits, _mm_cmpeq_epi8(bytes, _mm_set1_epi8(DELIMITER_CHARS[i])));
+            }
+            mask |= static_cast<uint64_t>(_mm_movemask_epi8(hits)) << offset;
+        }
+        return mask;
+    }
+
+    /**
+     * @brief AVX2 kernel, classifies 32 bytes per compare.
+     */
+    __attribute__((target("avx2")))
+    uint64_t classifyAvx2(const char* block) {
+        uint64_t mask = 0;
+        for(size_t offset = 0; offset < Tokenizer::BLOCK_SIZE; offset += 32) {
+            __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + offset));
+
+            // Set each byte that matches one of the delimiter characters.
+            __m256i hits = _mm256_setzero_si256();
+            for(size_t i = 0; i < DELIMITER_COUNT; i++) {
+                hits = _mm256_or_si256(hits, _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(DELIMITER_CHARS[i])));
+            }
+            mask |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(hits))) << offset;
+        }
+        return mask;
+    }
+#endif
+}
+
+Tokenizer::Kernel Tokenizer::kernel = Tokenizer::detectKernel();
+
+Tokenizer::ClassifyFunction Tokenizer::classifyFunction = Tokenizer::getClassifyFunction(Tokenizer::kernel);
+
+Tokenizer::Tokenizer(char* command) {
+    vectorized   = kernel != SCALAR;
+    savePosition = command;
+    if(!vectorized) return;
+
+    end   = command + std::strlen(command);
+    block = command;
+    carry = 1; // The string starts as if after a delimiter, so its first boundary starts a token.
+    loadBlock();
+}
+
+char* Tokenizer::next() {
+    // libc's strtok_r() beats classifying bytes without vector compares.
+    if(!vectorized) {
+        return strtok_r(savePosition, DELIMITER_CHARS, &savePosition);
+    }
+
+    // Boundaries alternate between token starts and token ends.
+    char* start = nextBoundary();
+    if(start == end) return nullptr;
+
+    // Null-terminate the token; the mask already holds the boundaries after it.
+    char* stop = nextBoundary();
+    if(stop != end) {
+        *stop = '\0';
+    }
+    return start;
+}
+
+const char* Tokenizer::scan(const char* begin, const char* end, bool delimiter) {
+    while(begin < end) {
+        uint64_t mask = classify(begin, end);
+        uint64_t candidates = delimiter ? mask : ~mask;
+        if(candidates != 0) return std::min(begin + __builtin_ctzll(candidates), end);
+        if(end - begin <= static_cast<ptrdiff_t>(BLOCK_SIZE)) break;
+        begin += BLOCK_SIZE;
+    }
+    return end;
+}
+
+bool Tokenizer::isSupported(Kernel candidate) {
+    switch(candidate) {
+        case SCALAR:
+            return true;
+#ifdef TOKENIZER_X86
+        case SSE2:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("sse2");
+        case AVX2:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2");
+#endif
+        default:
+            return false;
+    }
+}
+
+void Tokenizer::selectKernel(Kernel selected) {
+    if(!isSupported(selected)) return;
+    kernel           = selected;
+    classifyFunction = getClassifyFunction(selected);
+}
+
+Tokenizer::Kernel Tokenizer::getKernel() {
+    return kernel;
+}
+
+Tokenizer::Kernel Tokenizer::detectKernel() {
+    if(isSupported(AVX2)) return AVX2;
+    if(isSupported(SSE2)) return SSE2;
+    return SCALAR;
+}
+
+Tokenizer::ClassifyFunction Tokenizer::getClassifyFunction(Kernel selected) {
+    switch(selected) {
+#ifdef TOKENIZER_X86
+        case SSE2: return classifySse2;
+        case AVX2: return classifyAvx2;
+#endif
+        default:   return classifyScalar;
+    }
+}
+
+uint64_t Tokenizer::classify(const char* at, const char* end) {
+    if(end - at >= static_cast<ptrdiff_t>(BLOCK_SIZE)) return classifyFunction(at);
+
+    // Pad a short tail with delimiters so the kernels never read past the string.
+    char padded[BLOCK_SIZE];
+    std::memset(padded, DELIMITER_CHARS[0], BLOCK_SIZE);
+    std::memcpy(padded, at, end - at);
+    return classifyFunction(padded);
+}
+
+void Tokenizer::loadBlock() {
+    // A boundary is wherever a byte's class differs from the byte before it.
+    uint64_t delimiters = classify(block, end);
+    boundaries = delimiters ^ ((delimiters << 1) | carry);
+    carry      = delimiters >> (BLOCK_SIZE - 1);
+}
+
+char* Tokenizer::nextBoundary() {
+    while(boundaries == 0) {
+        if(end - block <= static_cast<ptrdiff_t>(BLOCK_SIZE)) return end;
+        block += BLOCK_SIZE;
+        loadBlock();
+    }
+
+    char* boundary = block + __builtin_ctzll(boundaries);
+    boundaries &= boundaries - 1; // Clear the lowest set bit.
+    return boundary;
+}
@@ -0,0 +1,218 @@
+/**
+ * @file tokenizer.hpp
+ * @brief Declares the Tokenizer class and the character-class table used to split commands.
+ *
+ * This file provides a compile-time 256-entry character-class table and the
+ * Tokenizer class, which splits a command string into tokens in place like
+ * `strtok()`. A classifying kernel turns each 64-byte block into a bitmask of its
+ * delimiters, 8 (scalar), 16 (SSE2) or 32 (AVX2) bytes at a time, chosen at runtime
+ * from what the CPU supports. Every token boundary in a block is then taken from the
+ * mask without reading the bytes again. Without vector kernels, tokens are split with
+ * `strtok_r()`, which the scalar kernel can't outrun.
+ *
+ * @author Noah Nickles
+ * @author Dylan Stephens
+ * @date 10/19/2026
+ * @details Course COP4634
+ */
+
+#ifndef _TOKENIZER_HPP
+#define _TOKENIZER_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+/// @brief Character classes; a character may belong to several.
+enum CharClass : unsigned char {
+    ORDINARY_CLASS  = 0,
+    DELIMITER_CLASS = 1 << 0, // Separates tokens.
+    OPERATOR_CLASS  = 1 << 1, // Starts a redirection or background token.
+    QUOTE_CLASS     = 1 << 2  // Reserved for quoting; doesn't affect token boundaries yet.
+};
+
+// Characters that separate tokens (space or tab).
+static constexpr const char* DELIMITER_CHARS = " \t";
+
+// Number of characters in DELIMITER_CHARS, a constant so the kernels unroll over them.
+static constexpr size_t DELIMITER_COUNT = std::char_traits<char>::length(DELIMITER_CHARS);
+
+// Characters that start an operator token (`<`, `>` and `&`).
+static constexpr const char* OPERATOR_CHARS  = "<>&";
+
+// Quote characters (`'` and `"`).
+static constexpr const char* QUOTE_CHARS     = "\'\"";
+
+/**
+ * @brief Builds the character-class table at compile time.
+ *
+ * @return A table mapping every byte value to its CharClass bits.
+ */
+constexpr std::array<unsigned char, 256> buildCharClassTable() {
+    std::array<unsigned char, 256> table = {};
+
+    const char* sets[]           = { DELIMITER_CHARS, OPERATOR_CHARS, QUOTE_CHARS };
+    const unsigned char bits[]   = { DELIMITER_CLASS, OPERATOR_CLASS, QUOTE_CLASS };
+    for(int i = 0; i < 3; i++) {
+        for(const char* c = sets[i]; *c != '\0'; c++) {
+            table[static_cast<unsigned char>(*c)] |= bits[i];
+        }
+    }
+    return table;
+}
+
+// Character class of every byte value.
+static constexpr std::array<unsigned char, 256> CHAR_CLASS_TABLE = buildCharClassTable();
+
+/**
+ * @brief Class to split a command string into tokens in place.
+ *
+ * Behaves like repeated `strtok(command, DELIMITER_CHARS)` calls: each token is
+ * null-terminated inside the command string. Unlike strtok(), the position is kept
+ * in the object, so several commands can be tokenized at once. The token boundaries
+ * of the current block are kept as a bitmask, so each token costs a few bit operations
+ * and every byte is classified once.
+ */
+class Tokenizer {
+    public:
+        /// @brief Available classifying kernels.
+        enum Kernel { SCALAR, SSE2, AVX2 };
+
+        /// @brief Number of bytes classified at once.
+        static constexpr size_t BLOCK_SIZE = 64;
+
+        /**
+         * @brief Signature of a classifying kernel.
+         *
+         * Returns a mask with bit i set if block[i] is a delimiter, for the
+         * BLOCK_SIZE bytes starting at block.
+         */
+        using ClassifyFunction = uint64_t (*)(const char* block);
+
+    private:
+        // Set if tokens are taken from block masks, otherwise strtok_r() splits them.
+        bool vectorized;
+
+        // strtok_r() position, used when not vectorized.
+        char* savePosition;
+
+        // End of the command string (its null-terminator).
+        char* end;
+
+        // Start of the block being walked.
+        char* block;
+
+        /*
+         * Token boundaries of the block not returned yet: bit i is set where byte i 
+         * starts or ends a token. Bytes past end count as delimiters.
+        */
+        uint64_t boundaries;
+
+        // 1 if the byte before the block is a delimiter (or the block starts the string).
+        uint64_t carry;
+
+        // Kernel used by every Tokenizer, chosen from the CPU's features at startup.
+        static Kernel kernel;
+
+        // Classifying function of the selected kernel.
+        static ClassifyFunction classifyFunction;
+
+        /**
+         * @brief Picks the fastest kernel the CPU supports.
+         *
+         * @return AVX2 if available, otherwise SSE2 if available, otherwise SCALAR.
+         */
+        static Kernel detectKernel();
+
+        /**
+         * @brief Retrieves the classifying function of a kernel.
+         *
+         * @param selected The kernel.
+         * @return Its classifying function.
+         */
+        static ClassifyFunction getClassifyFunction(Kernel selected);
+
+        /**
+         * @brief Classifies the block at a position, even if fewer than BLOCK_SIZE bytes remain.
+         *
+         * @param at Start of the block.
+         * @param end End of the range; the bytes from it on count as delimiters.
+         * @return The delimiter mask of the block.
+         */
+        static uint64_t classify(const char* at, const char* end);
+
+        /**
+         * @brief Classifies the current block and records its token boundaries.
+         */
+        void loadBlock();
+
+        /**
+         * @brief Pops the next token boundary, classifying further blocks as needed.
+         *
+         * @return The position of the boundary, or end if there is none.
+         */
+        char* nextBoundary();
+
+    public:
+        /**
+         * @brief Constructs a Tokenizer over a null-terminated command string.
+         *
+         * @param command The command string; it is modified as tokens are returned.
+         */
+        explicit Tokenizer(char* command);
+
+        /**
+         * @brief Returns the next token, null-terminating it in place.
+         *
+         * @return The next token, or nullptr if no tokens are left.
+         */
+        char* next();
+
+        /**
+         * @brief Finds the first byte in [begin, end) that is or isn't a delimiter.
+         *
+         * @param begin Start of the range.
+         * @param end End of the range.
+         * @param delimiter true to find the next delimiter, false to skip delimiters.
+         * @return The first matching position, or end if there is none.
+         */
+        static const char* scan(const char* begin, const char* end, bool delimiter);
+
+        /**
+         * @brief Checks whether a character belongs to a class.
+         *
+         * @param c The character.
+         * @param charClass The CharClass bits to test.
+         * @return true if c has any of the bits, false otherwise.
+         */
+        static constexpr bool is(char c, unsigned char charClass) {
+            return (CHAR_CLASS_TABLE[static_cast<unsigned char>(c)] & charClass) != 0;
+        }
+
+        /**
+         * @brief Checks whether the CPU supports a kernel.
+         *
+         * @param candidate The kernel.
+         * @return true if it can be selected, false otherwise.
+         */
+        static bool isSupported(Kernel candidate);
+
+        /**
+         * @brief Overrides the detected kernel, e.g. to compare kernels in a benchmark.
+         *
+         * @param selected The kernel to use; unsupported kernels are ignored.
+         */
+        static void selectKernel(Kernel selected);
+
+        /**
+         * @brief Retrieves the kernel in use.
+         *
+         * @return The selected kernel.
+         */
+        static Kernel getKernel();
+};
+
+#endif